@@ -13,17 +13,21 @@
 
 #include <algorithm>
 
+#include <cpputility/trace.hpp>
+
 namespace cpputility
 {
 template<typename Container, typename T>
 auto find_element(const Container &c, const T &t)
 {
+    CPPUTILITY_TRACE_SCOPE("cpputility::find_element");
     return std::find(c.begin(), c.end(), t);
 }
 
 template<typename Container, typename Predicate>
 auto find_element_if(const Container &c, const Predicate &pred)
 {
+    CPPUTILITY_TRACE_SCOPE("cpputility::find_element_if");
     return std::find_if(c.begin(), c.end(), pred);
 }
 
@@ -42,6 +46,7 @@ bool has_element_if(const Container &c, const Predicate &pred)
 template<typename Container, typename Operation>
 void for_each(Container &container, Operation operation)
 {
+    CPPUTILITY_TRACE_SCOPE("cpputility::for_each");
     for (auto &elem : container) {
         operation(elem);
     }
@@ -50,6 +55,7 @@ void for_each(Container &container, Operation operation)
 template<typename Container, typename Operation>
 void for_each(const Container &container, Operation operation)
 {
+    CPPUTILITY_TRACE_SCOPE("cpputility::for_each");
     for (const auto &elem : container) {
         operation(elem);
     }
@@ -58,6 +64,7 @@ void for_each(const Container &container, Operation operation)
 template<typename Container, typename Operation>
 void for_each(Container &&container, Operation operation)
 {
+    CPPUTILITY_TRACE_SCOPE("cpputility::for_each");
     for (auto &&elem : container) {
         operation(elem);
     }
@@ -66,6 +73,7 @@ void for_each(Container &&container, Operation operation)
 template<typename Iterator, typename Predicate, typename Operation>
 void for_each_if(Iterator begin, Iterator end, Predicate pred, Operation op)
 {
+    CPPUTILITY_TRACE_SCOPE("cpputility::for_each_if");
     for (; begin != end; ++begin) {
         if (pred(*begin)) {
             op(begin);
@@ -76,6 +84,7 @@ void for_each_if(Iterator begin, Iterator end, Predicate pred, Operation op)
 template<typename Container, typename Predicate, typename Operation>
 void for_each_if(Container &container, Predicate pred, Operation op)
 {
+    CPPUTILITY_TRACE_SCOPE("cpputility::for_each_if");
     for (auto &elem : container) {
         if (pred(elem)) {
             op(elem);
@@ -86,6 +95,7 @@ void for_each_if(Container &container, Predicate pred, Operation op)
 template<typename Container, typename Predicate, typename Operation>
 void for_each_if(const Container &container, Predicate pred, Operation op)
 {
+    CPPUTILITY_TRACE_SCOPE("cpputility::for_each_if");
     for (const auto &elem : container) {
         if (pred(elem)) {
             op(elem);
@@ -96,6 +106,7 @@ void for_each_if(const Container &container, Predicate pred, Operation op)
 template<typename Container, typename Predicate, typename Operation>
 void for_each_if(Container &&container, Predicate pred, Operation op)
 {
+    CPPUTILITY_TRACE_SCOPE("cpputility::for_each_if");
     for (auto &&elem : container) {
         if (pred(elem)) {
             op(elem);
@@ -0,0 +1,93 @@
+/* NetSim Project - Numerical Simulation, Analysis and Optimization of District Heating Networks
+ *
+ * include/cpputility/bits.hpp
+ *
+ * created: 2026-10-19, Dominik Linn <d.linn@gmx.net> <dominik.linn@itwm.fraunhofer.de>
+ *
+ * (c) 2026 Dominik Linn, Fraunhofer ITWM
+ *
+ */
+
+#ifndef CPPUTILITY_BITS_HPP
+#define CPPUTILITY_BITS_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace cpputility
+{
+using std::size_t;
+
+constexpr size_t bits_per_word = 64;
+
+inline size_t word_count(size_t bits)
+{
+    return (bits + bits_per_word - 1) / bits_per_word;
+}
+
+/// Index of the lowest set bit, word must not be zero.
+inline unsigned count_trailing_zeros(std::uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_ctzll(word));
+#elif defined(_MSC_VER)
+    unsigned long index;
+    _BitScanForward64(&index, word);
+    return static_cast<unsigned>(index);
+#else
+    unsigned index = 0;
+    for (; (word & 1) == 0; word >>= 1) {
+        ++index;
+    }
+    return index;
+#endif
+}
+
+/// Index of the highest set bit counted from the top, word must not be zero.
+inline unsigned count_leading_zeros(std::uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_clzll(word));
+#elif defined(_MSC_VER)
+    unsigned long index;
+    _BitScanReverse64(&index, word);
+    return 63 - static_cast<unsigned>(index);
+#else
+    unsigned count = 0;
+    for (; (word & (std::uint64_t{1} << 63)) == 0; word <<= 1) {
+        ++count;
+    }
+    return count;
+#endif
+}
+
+inline unsigned popcount(std::uint64_t word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<unsigned>(__builtin_popcountll(word));
+#elif defined(_MSC_VER)
+    return static_cast<unsigned>(__popcnt64(word));
+#else
+    unsigned count = 0;
+    for (; word != 0; word &= word - 1) {
+        ++count;
+    }
+    return count;
+#endif
+}
+
+/// Calls operation(index) for every set bit of word, index being offset plus the bit position.
+template<typename Operation>
+void for_each_set_bit(std::uint64_t word, size_t offset, Operation operation)
+{
+    for (; word != 0; word &= word - 1) {
+        operation(offset + count_trailing_zeros(word));
+    }
+}
+} // namespace cpputility
+
+#endif // CPPUTILITY_BITS_HPP
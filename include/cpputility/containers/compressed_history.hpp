@@ -0,0 +1,298 @@
+/* NetSim Project - Numerical Simulation, Analysis and Optimization of District Heating Networks
+ *
+ * include/cpputility/containers/compressed_history.hpp
+ *
+ * created: 2026-10-19, Dominik Linn <d.linn@gmx.net> <dominik.linn@itwm.fraunhofer.de>
+ *
+ * (c) 2026 Dominik Linn, Fraunhofer ITWM
+ *
+ */
+
+#ifndef CPPUTILITY_CONTAINERS_COMPRESSED_HISTORY_HPP
+#define CPPUTILITY_CONTAINERS_COMPRESSED_HISTORY_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <vector>
+
+#include <cpputility/bits.hpp>
+
+namespace cpputility
+{
+/// Default number of timesteps per block of a CompressedHistory.
+constexpr ptrdiff_t default_history_block_length = 16;
+
+namespace detail
+{
+/// Range of meaningful bits of the last explicitly encoded XOR value, meaningful == 0 if there
+/// is none yet.
+struct XorWindow
+{
+    unsigned leading = 0;
+    unsigned meaningful = 0;
+};
+
+class BitReader
+{
+private:
+    std::uint64_t const *m_words;
+    size_t m_position;
+
+public:
+    BitReader(std::uint64_t const *words, size_t position) : m_words{words}, m_position{position}
+    {
+    }
+
+    /// Reads count (1 to 64) bits, the first bit read is the lowest bit of the result.
+    inline std::uint64_t read(unsigned count)
+    {
+        auto const word = m_position / bits_per_word;
+        auto const offset = static_cast<unsigned>(m_position % bits_per_word);
+        auto result = m_words[word] >> offset;
+        if (offset + count > bits_per_word) {
+            result |= m_words[word + 1] << (bits_per_word - offset);
+        }
+        m_position += count;
+        return count < bits_per_word ? result & ((std::uint64_t{1} << count) - 1) : result;
+    }
+};
+} // namespace detail
+
+/// Losslessly compressed history of a vector of doubles or floats, one row of width values per
+/// timestep.
+///
+/// Every value is XORed with the value of the same element in the previous timestep and the
+/// result is stored Gorilla-style: a single bit if the value did not change, otherwise only the
+/// meaningful bits between the leading and trailing zeros, reusing the bit window of the previous
+/// element where possible. Slowly changing histories shrink to a fraction of their size.
+///
+/// Timesteps are grouped into blocks of block_length; the first timestep of a block is XORed with
+/// the previous element of the same timestep instead, so a timestep is decoded by replaying at
+/// most block_length timesteps from the start of its block. Decoding writes straight into any
+/// container with size() and operator[] (std::vector, VectorView, VectorSlice, ...) and needs no
+/// additional buffer.
+template<typename BaseT, typename AllocT = std::allocator<BaseT>>
+class CompressedHistory
+{
+    static_assert(std::is_same<BaseT, double>::value || std::is_same<BaseT, float>::value,
+                  "CompressedHistory supports double and float only");
+
+public:
+    using value_type = BaseT;
+    using allocator_type = AllocT;
+    using bits_type = std::conditional_t<sizeof(BaseT) == 8, std::uint64_t, std::uint32_t>;
+    using word_allocator_type =
+        typename std::allocator_traits<AllocT>::template rebind_alloc<std::uint64_t>;
+    using offset_allocator_type =
+        typename std::allocator_traits<AllocT>::template rebind_alloc<size_t>;
+    using bits_allocator_type =
+        typename std::allocator_traits<AllocT>::template rebind_alloc<bits_type>;
+
+private:
+    static constexpr unsigned value_bits = sizeof(bits_type) * 8;
+    static constexpr unsigned field_bits = sizeof(bits_type) == 8 ? 6 : 5;
+
+    std::vector<std::uint64_t, word_allocator_type> m_stream;
+    size_t m_streamBits = 0;
+    std::vector<size_t, offset_allocator_type> m_offsets;
+    std::vector<bits_type, bits_allocator_type> m_last;
+    ptrdiff_t m_width;
+    ptrdiff_t m_blockLength;
+
+public:
+    explicit CompressedHistory(ptrdiff_t width,
+                               ptrdiff_t block_length = default_history_block_length,
+                               AllocT const &allocator = AllocT{})
+        : m_stream(word_allocator_type(allocator)), m_offsets(offset_allocator_type(allocator)),
+          m_last(static_cast<size_t>(width), bits_type{0}, bits_allocator_type(allocator)),
+          m_width{width}, m_blockLength{block_length}
+    {
+        assert(width >= 0 && block_length > 0);
+    }
+
+    inline allocator_type get_allocator() const { return allocator_type(m_stream.get_allocator()); }
+
+    inline ptrdiff_t width() const { return m_width; }
+
+    inline ptrdiff_t timesteps() const { return static_cast<ptrdiff_t>(m_offsets.size()); }
+
+    inline ptrdiff_t block_length() const { return m_blockLength; }
+
+    inline bool empty() const { return m_offsets.empty(); }
+
+    /// Bytes allocated for the encoded timesteps, the offsets and the last row.
+    size_t compressed_bytes() const
+    {
+        return m_stream.capacity() * sizeof(std::uint64_t) + m_offsets.capacity() * sizeof(size_t)
+               + m_last.capacity() * sizeof(bits_type);
+    }
+
+    inline size_t uncompressed_bytes() const
+    {
+        return m_offsets.size() * static_cast<size_t>(m_width) * sizeof(BaseT);
+    }
+
+    /// Appends the values of one timestep, values.size() has to equal width().
+    template<class Container>
+    void append(Container const &values)
+    {
+        assert(static_cast<ptrdiff_t>(values.size()) == m_width);
+        bool const keyframe = timesteps() % m_blockLength == 0;
+        m_offsets.push_back(m_streamBits);
+
+        detail::XorWindow window;
+        bits_type previous = 0;
+        for (ptrdiff_t pos = 0; pos < m_width; ++pos) {
+            auto const bits = to_bits(values[pos]);
+            auto &last = m_last[static_cast<size_t>(pos)];
+            encode(bits ^ (keyframe ? previous : last), window);
+            previous = bits;
+            last = bits;
+        }
+    }
+
+    /// Writes the values of timestep into output, output.size() has to equal width().
+    template<class Container>
+    void decode(ptrdiff_t timestep, Container &&output) const
+    {
+        assert(timestep < timesteps());
+        auto const blockBegin = timestep - timestep % m_blockLength;
+        for (auto step = blockBegin; step <= timestep; ++step) {
+            decode_step(step, output);
+        }
+    }
+
+    /// Decodes the timesteps [begin, end) one after another into buffer and calls
+    /// operation(timestep, buffer) for each of them. Only the first timestep costs a replay from
+    /// the start of its block, all further ones are decoded incrementally.
+    template<class Container, typename Operation>
+    void for_each_timestep(ptrdiff_t begin,
+                           ptrdiff_t end,
+                           Container &&buffer,
+                           Operation operation) const
+    {
+        assert(begin <= end && end <= timesteps());
+        if (begin == end) {
+            return;
+        }
+        decode(begin, buffer);
+        operation(begin, buffer);
+        for (auto step = begin + 1; step < end; ++step) {
+            decode_step(step, buffer);
+            operation(step, buffer);
+        }
+    }
+
+    void clear()
+    {
+        m_stream.clear();
+        m_streamBits = 0;
+        m_offsets.clear();
+    }
+
+    /// Releases the unused capacity of the growing stream, e.g. once a simulation finished.
+    void shrink_to_fit()
+    {
+        m_stream.shrink_to_fit();
+        m_offsets.shrink_to_fit();
+    }
+
+private:
+    static inline bits_type to_bits(BaseT value)
+    {
+        bits_type bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    static inline BaseT from_bits(bits_type bits)
+    {
+        BaseT value;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    /// Appends the lowest count (1 to 64) bits of value to the stream.
+    void write(std::uint64_t value, unsigned count)
+    {
+        auto const offset = static_cast<unsigned>(m_streamBits % bits_per_word);
+        if (offset == 0) {
+            m_stream.push_back(0);
+        }
+        m_stream.back() |= value << offset;
+        if (offset + count > bits_per_word) {
+            m_stream.push_back(value >> (bits_per_word - offset));
+        }
+        m_streamBits += count;
+    }
+
+    void encode(bits_type xorValue, detail::XorWindow &window)
+    {
+        if (xorValue == 0) {
+            write(0, 1);
+            return;
+        }
+
+        auto const leading = count_leading_zeros(xorValue) - (bits_per_word - value_bits);
+        auto const trailing = count_trailing_zeros(xorValue);
+        if (window.meaningful != 0 && leading >= window.leading
+            && trailing >= value_bits - window.leading - window.meaningful) {
+            write(0b01, 2);
+            auto const windowTrailing = value_bits - window.leading - window.meaningful;
+            write(xorValue >> windowTrailing, window.meaningful);
+            return;
+        }
+
+        window.leading = leading;
+        window.meaningful = value_bits - leading - trailing;
+        write(0b11, 2);
+        write(window.leading, field_bits);
+        write(window.meaningful - 1, field_bits);
+        write(xorValue >> trailing, window.meaningful);
+    }
+
+    static bits_type decode_xor(detail::BitReader &reader, detail::XorWindow &window)
+    {
+        if (reader.read(1) == 0) {
+            return 0;
+        }
+        if (reader.read(1) == 1) {
+            window.leading = static_cast<unsigned>(reader.read(field_bits));
+            window.meaningful = static_cast<unsigned>(reader.read(field_bits)) + 1;
+        }
+        auto const trailing = value_bits - window.leading - window.meaningful;
+        return static_cast<bits_type>(reader.read(window.meaningful) << trailing);
+    }
+
+    /// Decodes timestep into output, which has to hold the previous timestep unless timestep
+    /// starts a block.
+    template<class Container>
+    void decode_step(ptrdiff_t timestep, Container &output) const
+    {
+        assert(static_cast<ptrdiff_t>(output.size()) == m_width);
+        bool const keyframe = timestep % m_blockLength == 0;
+        detail::BitReader reader(m_stream.data(), m_offsets[static_cast<size_t>(timestep)]);
+
+        detail::XorWindow window;
+        bits_type previous = 0;
+        for (ptrdiff_t pos = 0; pos < m_width; ++pos) {
+            auto const reference = keyframe ? previous : to_bits(output[pos]);
+            previous = reference ^ decode_xor(reader, window);
+            output[pos] = from_bits(previous);
+        }
+    }
+};
+
+namespace pmr
+{
+template<typename BaseT>
+using CompressedHistory
+    = cpputility::CompressedHistory<BaseT, std::pmr::polymorphic_allocator<BaseT>>;
+} // namespace pmr
+} // namespace cpputility
+#endif // CPPUTILITY_CONTAINERS_COMPRESSED_HISTORY_HPP
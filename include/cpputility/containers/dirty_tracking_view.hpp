@@ -0,0 +1,235 @@
+/* NetSim Project - Numerical Simulation, Analysis and Optimization of District Heating Networks
+ *
+ * include/cpputility/containers/dirty_tracking_view.hpp
+ *
+ * created: 2026-10-19, Dominik Linn <d.linn@gmx.net> <dominik.linn@itwm.fraunhofer.de>
+ *
+ * (c) 2026 Dominik Linn, Fraunhofer ITWM
+ *
+ */
+
+#ifndef CPPUTILITY_CONTAINERS_DIRTY_TRACKING_VIEW_HPP
+#define CPPUTILITY_CONTAINERS_DIRTY_TRACKING_VIEW_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <cpputility/bits.hpp>
+#include <cpputility/containers/iterator.hpp>
+#include <cpputility/containers/vector_base.hpp>
+
+namespace cpputility
+{
+/// View recording which blocks of the underlying vector were written since the last
+/// clear_dirty().
+///
+/// Every non-const element access (operator[], front(), back(), dereferencing a mutable iterator)
+/// conservatively marks the block of the element dirty, set() only marks it if the value actually
+/// changes. Read-only access through a const view is never recorded. Optionally the indices of the
+/// dirty elements are collected as well.
+///
+/// The view follows size changes of the underlying vector: the tracking grows with the first
+/// write beyond the previous size, and blocks beyond the end of a shrunk vector are ignored.
+/// Copies are not allowed, since they would record writes to the same vector separately.
+template<class VectorT>
+class DirtyTrackingView
+    : public VectorBase<DirtyTrackingView<VectorT>, typename VectorT::value_type>
+{
+public:
+    using value_type = typename VectorT::value_type;
+
+    static constexpr size_t default_block_size = 256;
+
+private:
+    VectorT *m_base;
+    size_t m_blockSize;
+    std::vector<std::uint64_t> m_dirtyBlocks;
+    bool m_trackIndices;
+    std::vector<std::uint64_t> m_dirtyElements;
+    std::vector<size_t> m_dirtyIndices;
+
+public:
+    DirtyTrackingView() = delete;
+
+    explicit DirtyTrackingView(VectorT &array,
+                               size_t block_size = default_block_size,
+                               bool track_indices = false)
+        : m_base{&array}, m_blockSize{std::max(block_size, size_t{1})},
+          m_trackIndices{track_indices}
+    {
+        resize_tracking();
+    }
+
+    DirtyTrackingView(DirtyTrackingView const &other) = delete;
+
+    DirtyTrackingView(DirtyTrackingView &&other) = default;
+
+    DirtyTrackingView &operator=(DirtyTrackingView const &other) = delete;
+
+    DirtyTrackingView &operator=(DirtyTrackingView &&other) = default;
+
+    virtual ~DirtyTrackingView() = default;
+
+    inline value_type &get(ptrdiff_t pos)
+    {
+        mark_dirty(static_cast<size_t>(pos));
+        return (*m_base)[pos];
+    }
+
+    inline value_type const &get(ptrdiff_t pos) const { return (*m_base)[pos]; }
+
+    inline value_type &get_front() { return get(0); }
+
+    inline value_type const &get_front() const { return get(0); }
+
+    inline value_type &get_back() { return get(get_size() - 1); }
+
+    inline value_type const &get_back() const { return get(get_size() - 1); }
+
+    inline ptrdiff_t get_size() const { return m_base->size(); }
+
+    /// Assigns value to the element at pos and marks it dirty only if the value changed.
+    template<typename ValueT>
+    void set(ptrdiff_t pos, ValueT &&value)
+    {
+        auto &element = (*m_base)[pos];
+        if (!(element == value)) {
+            element = std::forward<ValueT>(value);
+            mark_dirty(static_cast<size_t>(pos));
+        }
+    }
+
+    inline void mark_dirty(size_t pos)
+    {
+        assert(pos < static_cast<size_t>(get_size()));
+        auto const block = pos / m_blockSize;
+        if (block / bits_per_word >= m_dirtyBlocks.size()
+            || (m_trackIndices && pos / bits_per_word >= m_dirtyElements.size())) {
+            // the vector grew since the tracking was sized
+            resize_tracking();
+        }
+        m_dirtyBlocks[block / bits_per_word] |= std::uint64_t{1} << (block % bits_per_word);
+
+        if (m_trackIndices) {
+            auto &word = m_dirtyElements[pos / bits_per_word];
+            auto const bit = std::uint64_t{1} << (pos % bits_per_word);
+            if ((word & bit) == 0) {
+                word |= bit;
+                m_dirtyIndices.push_back(pos);
+            }
+        }
+    }
+
+    void mark_all_dirty()
+    {
+        auto const step = m_trackIndices ? size_t{1} : m_blockSize;
+        for (size_t pos = 0; pos < static_cast<size_t>(get_size()); pos += step) {
+            mark_dirty(pos);
+        }
+    }
+
+    /// Forgets all recorded writes.
+    void clear_dirty()
+    {
+        resize_tracking();
+        std::fill(m_dirtyBlocks.begin(), m_dirtyBlocks.end(), 0);
+        std::fill(m_dirtyElements.begin(), m_dirtyElements.end(), 0);
+        m_dirtyIndices.clear();
+    }
+
+    inline size_t block_size() const { return m_blockSize; }
+
+    inline size_t block_count() const
+    {
+        return (static_cast<size_t>(get_size()) + m_blockSize - 1) / m_blockSize;
+    }
+
+    inline bool is_dirty_block(size_t block) const
+    {
+        return (dirty_word(block / bits_per_word) >> (block % bits_per_word)) & 1;
+    }
+
+    size_t dirty_block_count() const
+    {
+        size_t count = 0;
+        for (size_t word = 0; word < m_dirtyBlocks.size(); ++word) {
+            count += popcount(dirty_word(word));
+        }
+        return count;
+    }
+
+    bool has_dirty() const
+    {
+        for (size_t word = 0; word < m_dirtyBlocks.size(); ++word) {
+            if (dirty_word(word) != 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Indices of the written elements in order of their first write, only recorded if the view
+    /// was constructed with track_indices. After the vector shrank, indices beyond its end are
+    /// kept until the next clear_dirty().
+    inline std::vector<size_t> const &dirty_indices() const { return m_dirtyIndices; }
+
+    /// Calls operation(begin, end) for the element range of every dirty block in ascending order.
+    template<typename Operation>
+    void for_each_dirty_block(Operation operation) const
+    {
+        auto const size = static_cast<size_t>(get_size());
+        for (size_t word = 0; word < m_dirtyBlocks.size(); ++word) {
+            for_each_set_bit(dirty_word(word), word * bits_per_word, [&](size_t block) {
+                auto const begin = block * m_blockSize;
+                operation(begin, std::min(begin + m_blockSize, size));
+            });
+        }
+    }
+
+    /// Calls operation(pos) for every element of every dirty block.
+    template<typename Operation>
+    void for_each_dirty(Operation operation) const
+    {
+        for_each_dirty_block([&operation](size_t begin, size_t end) {
+            for (; begin != end; ++begin) {
+                operation(begin);
+            }
+        });
+    }
+
+    /// for_each_dirty_block followed by clear_dirty.
+    template<typename Operation>
+    void consume_dirty_blocks(Operation operation)
+    {
+        for_each_dirty_block(operation);
+        clear_dirty();
+    }
+
+private:
+    /// Dirty bits of word, without the blocks beyond the end of the vector.
+    inline std::uint64_t dirty_word(size_t word) const
+    {
+        auto const blocks = block_count();
+        if (word >= m_dirtyBlocks.size() || word * bits_per_word >= blocks) {
+            return 0;
+        }
+        auto const valid = blocks - word * bits_per_word;
+        auto const bits = m_dirtyBlocks[word];
+        return valid >= bits_per_word ? bits : bits & ((std::uint64_t{1} << valid) - 1);
+    }
+
+    void resize_tracking()
+    {
+        m_dirtyBlocks.resize(word_count(block_count()), 0);
+        if (m_trackIndices) {
+            m_dirtyElements.resize(word_count(static_cast<size_t>(get_size())), 0);
+        }
+    }
+};
+
+} // namespace cpputility
+#endif // CPPUTILITY_CONTAINERS_DIRTY_TRACKING_VIEW_HPP
@@ -0,0 +1,228 @@
+/* NetSim Project - Numerical Simulation, Analysis and Optimization of District Heating Networks
+ *
+ * include/cpputility/containers/flat_hash_index.hpp
+ *
+ * created: 2026-10-19, Dominik Linn <d.linn@gmx.net> <dominik.linn@itwm.fraunhofer.de>
+ *
+ * (c) 2026 Dominik Linn, Fraunhofer ITWM
+ *
+ */
+
+#ifndef CPPUTILITY_CONTAINERS_FLAT_HASH_INDEX_HPP
+#define CPPUTILITY_CONTAINERS_FLAT_HASH_INDEX_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+namespace cpputility
+{
+/// Open addressing hash map with linear probing, all slots stored in one contiguous array.
+///
+/// Key and value are stored in the slot, so a lookup costs a single cache miss in the common case
+/// of finding the key in its home slot. The table is at most half full and erased slots are
+/// refilled by shifting the following entries back, so there are no tombstones and probe
+/// sequences stay short however often entries are erased. Hash values are spread by Fibonacci
+/// hashing, which makes identity hashes of consecutive ids (like std::hash<int>) usable.
+template<typename KeyT,
+         typename ValueT,
+         typename Hash = std::hash<KeyT>,
+         typename KeyEqual = std::equal_to<KeyT>,
+         typename AllocT = std::allocator<std::pair<KeyT const, ValueT>>>
+class FlatHashIndex
+{
+private:
+    struct Slot
+    {
+        KeyT key{};
+        ValueT value{};
+        bool occupied = false;
+    };
+
+    using slot_allocator_type = typename std::allocator_traits<AllocT>::template rebind_alloc<Slot>;
+
+    std::vector<Slot, slot_allocator_type> m_slots;
+    size_t m_size = 0;
+    unsigned m_shift = 64;
+    Hash m_hash;
+    KeyEqual m_equal;
+
+public:
+    using key_type = KeyT;
+    using mapped_type = ValueT;
+    using allocator_type = AllocT;
+
+    FlatHashIndex() = default;
+
+    explicit FlatHashIndex(AllocT const &allocator) : m_slots(slot_allocator_type(allocator)) {}
+
+    explicit FlatHashIndex(size_t capacity,
+                           Hash hash = Hash{},
+                           KeyEqual equal = KeyEqual{},
+                           AllocT const &allocator = AllocT{})
+        : m_slots(slot_allocator_type(allocator)), m_hash{std::move(hash)},
+          m_equal{std::move(equal)}
+    {
+        reserve(capacity);
+    }
+
+    inline allocator_type get_allocator() const { return allocator_type(m_slots.get_allocator()); }
+
+    inline size_t size() const { return m_size; }
+
+    inline bool empty() const { return m_size == 0; }
+
+    /// Number of entries which can be inserted without rehashing.
+    inline size_t capacity() const { return m_slots.size() / 2; }
+
+    void reserve(size_t capacity)
+    {
+        if (capacity > this->capacity()) {
+            rehash(capacity);
+        }
+    }
+
+    void clear()
+    {
+        for (auto &slot : m_slots) {
+            slot = Slot{};
+        }
+        m_size = 0;
+    }
+
+    /// Inserts key -> value, returns false (and keeps the present value) if key is present.
+    bool insert(KeyT const &key, ValueT value)
+    {
+        reserve(m_size + 1);
+        auto const mask = m_slots.size() - 1;
+        for (auto index = home(key);; index = (index + 1) & mask) {
+            auto &slot = m_slots[index];
+            if (!slot.occupied) {
+                slot.key = key;
+                slot.value = std::move(value);
+                slot.occupied = true;
+                ++m_size;
+                return true;
+            }
+            if (m_equal(slot.key, key)) {
+                return false;
+            }
+        }
+    }
+
+    /// Pointer to the value stored for key, nullptr if key is not present.
+    ValueT *find(KeyT const &key)
+    {
+        auto const index = find_slot(key);
+        return index == m_slots.size() ? nullptr : &m_slots[index].value;
+    }
+
+    ValueT const *find(KeyT const &key) const
+    {
+        auto const index = find_slot(key);
+        return index == m_slots.size() ? nullptr : &m_slots[index].value;
+    }
+
+    inline bool contains(KeyT const &key) const { return find_slot(key) != m_slots.size(); }
+
+    /// Removes key, returns false if it was not present.
+    bool erase(KeyT const &key)
+    {
+        auto hole = find_slot(key);
+        if (hole == m_slots.size()) {
+            return false;
+        }
+
+        // Move every following entry of the probe run whose home slot does not lie cyclically in
+        // (hole, index] into the hole, until the run ends.
+        auto const mask = m_slots.size() - 1;
+        for (auto index = (hole + 1) & mask; m_slots[index].occupied; index = (index + 1) & mask) {
+            auto const entryHome = home(m_slots[index].key);
+            if (((index - entryHome) & mask) >= ((index - hole) & mask)) {
+                m_slots[hole] = std::move(m_slots[index]);
+                hole = index;
+            }
+        }
+        m_slots[hole] = Slot{};
+        --m_size;
+        return true;
+    }
+
+    /// Calls operation(key, value) for all entries in unspecified order.
+    template<typename Operation>
+    void for_each(Operation operation) const
+    {
+        for (auto const &slot : m_slots) {
+            if (slot.occupied) {
+                operation(slot.key, slot.value);
+            }
+        }
+    }
+
+private:
+    inline size_t home(KeyT const &key) const
+    {
+        auto const hash = static_cast<std::uint64_t>(m_hash(key));
+        return static_cast<size_t>((hash * 0x9E3779B97F4A7C15ull) >> m_shift);
+    }
+
+    size_t find_slot(KeyT const &key) const
+    {
+        if (m_size == 0) {
+            return m_slots.size();
+        }
+        auto const mask = m_slots.size() - 1;
+        for (auto index = home(key);; index = (index + 1) & mask) {
+            auto const &slot = m_slots[index];
+            if (!slot.occupied) {
+                return m_slots.size();
+            }
+            if (m_equal(slot.key, key)) {
+                return index;
+            }
+        }
+    }
+
+    /// Rebuilds the table with room for at least capacity entries at a load factor of 1/2.
+    void rehash(size_t capacity)
+    {
+        size_t slots = 16;
+        unsigned shift = 60;
+        while (slots < 2 * capacity) {
+            slots *= 2;
+            --shift;
+        }
+
+        std::vector<Slot, slot_allocator_type> old(slots, m_slots.get_allocator());
+        old.swap(m_slots);
+        m_shift = shift;
+        m_size = 0;
+        for (auto &slot : old) {
+            if (slot.occupied) {
+                insert(slot.key, std::move(slot.value));
+            }
+        }
+    }
+};
+
+namespace pmr
+{
+template<typename KeyT,
+         typename ValueT,
+         typename Hash = std::hash<KeyT>,
+         typename KeyEqual = std::equal_to<KeyT>>
+using FlatHashIndex
+    = cpputility::FlatHashIndex<KeyT,
+                                ValueT,
+                                Hash,
+                                KeyEqual,
+                                std::pmr::polymorphic_allocator<std::pair<KeyT const, ValueT>>>;
+} // namespace pmr
+} // namespace cpputility
+
+#endif // CPPUTILITY_CONTAINERS_FLAT_HASH_INDEX_HPP
@@ -0,0 +1,252 @@
+/* NetSim Project - Numerical Simulation, Analysis and Optimization of District Heating Networks
+ *
+ * include/cpputility/containers/hierarchical_bitset.hpp
+ *
+ * created: 2026-10-19, Dominik Linn <d.linn@gmx.net> <dominik.linn@itwm.fraunhofer.de>
+ *
+ * (c) 2026 Dominik Linn, Fraunhofer ITWM
+ *
+ */
+
+#ifndef CPPUTILITY_CONTAINERS_HIERARCHICAL_BITSET_HPP
+#define CPPUTILITY_CONTAINERS_HIERARCHICAL_BITSET_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+#include <cpputility/bits.hpp>
+
+namespace cpputility
+{
+/// Two level bitset: every bit of the summary level tells whether the corresponding 64 bit word
+/// of the element level is non-zero.
+///
+/// Setting and resetting single bits is O(1). Iteration visits only non-zero words, found with
+/// count-trailing-zeros on the summary, so empty ranges of 64 x 64 bits are skipped one summary
+/// word at a time and the cost scales with the number of set bits. Both levels are allocated
+/// with AllocT, use the aliases HierarchicalBitset and pmr::HierarchicalBitset.
+template<typename AllocT = std::allocator<std::uint64_t>>
+class BasicHierarchicalBitset
+{
+private:
+    std::vector<std::uint64_t, AllocT> m_words;
+    std::vector<std::uint64_t, AllocT> m_summary;
+    size_t m_size = 0;
+
+public:
+    using allocator_type = AllocT;
+
+    BasicHierarchicalBitset() = default;
+
+    explicit BasicHierarchicalBitset(AllocT const &allocator)
+        : m_words(allocator), m_summary(allocator)
+    {
+    }
+
+    explicit BasicHierarchicalBitset(size_t size, AllocT const &allocator = AllocT{})
+        : m_words(allocator), m_summary(allocator)
+    {
+        resize(size);
+    }
+
+    inline allocator_type get_allocator() const { return m_words.get_allocator(); }
+
+    /// Resizes the bitset, bits beyond the new size are cleared.
+    void resize(size_t size)
+    {
+        m_size = size;
+        m_words.resize(word_count(size), 0);
+        if (size % bits_per_word != 0) {
+            m_words.back() &= (std::uint64_t{1} << (size % bits_per_word)) - 1;
+        }
+        m_summary.assign(word_count(m_words.size()), 0);
+        for (size_t word = 0; word < m_words.size(); ++word) {
+            update_summary(word);
+        }
+    }
+
+    inline size_t size() const { return m_size; }
+
+    inline bool test(size_t pos) const
+    {
+        assert(pos < m_size);
+        return (m_words[pos / bits_per_word] >> (pos % bits_per_word)) & 1;
+    }
+
+    inline void set(size_t pos)
+    {
+        assert(pos < m_size);
+        auto const word = pos / bits_per_word;
+        m_words[word] |= std::uint64_t{1} << (pos % bits_per_word);
+        m_summary[word / bits_per_word] |= std::uint64_t{1} << (word % bits_per_word);
+    }
+
+    inline void reset(size_t pos)
+    {
+        assert(pos < m_size);
+        auto const word = pos / bits_per_word;
+        m_words[word] &= ~(std::uint64_t{1} << (pos % bits_per_word));
+        update_summary(word);
+    }
+
+    inline void set(size_t pos, bool value)
+    {
+        if (value) {
+            set(pos);
+        } else {
+            reset(pos);
+        }
+    }
+
+    /// Replaces the 64 bits starting at word * 64.
+    inline void set_word(size_t word, std::uint64_t bits)
+    {
+        assert(word < m_words.size());
+        m_words[word] = bits;
+        update_summary(word);
+    }
+
+    /// Sets all bits in [begin, end).
+    void set_range(size_t begin, size_t end)
+    {
+        assert(begin <= end && end <= m_size);
+        for (; begin < end && begin % bits_per_word != 0; ++begin) {
+            set(begin);
+        }
+        for (; begin + bits_per_word <= end; begin += bits_per_word) {
+            m_words[begin / bits_per_word] = ~std::uint64_t{0};
+            update_summary(begin / bits_per_word);
+        }
+        for (; begin < end; ++begin) {
+            set(begin);
+        }
+    }
+
+    void set_all()
+    {
+        if (m_size > 0) {
+            set_range(0, m_size);
+        }
+    }
+
+    void reset_all()
+    {
+        std::fill(m_words.begin(), m_words.end(), 0);
+        std::fill(m_summary.begin(), m_summary.end(), 0);
+    }
+
+    bool any() const
+    {
+        return std::any_of(m_summary.begin(), m_summary.end(), [](std::uint64_t word) {
+            return word != 0;
+        });
+    }
+
+    size_t count() const
+    {
+        size_t result = 0;
+        for_each_word([&result](size_t, std::uint64_t bits) { result += popcount(bits); });
+        return result;
+    }
+
+    /// this = this & other, only words non-zero in this are touched.
+    BasicHierarchicalBitset &operator&=(BasicHierarchicalBitset const &other)
+    {
+        assert(m_size == other.m_size);
+        for_each_word([&](size_t word, std::uint64_t bits) {
+            m_words[word] = bits & other.m_words[word];
+            update_summary(word);
+        });
+        return *this;
+    }
+
+    /// this = this | other, only words non-zero in other are touched.
+    BasicHierarchicalBitset &operator|=(BasicHierarchicalBitset const &other)
+    {
+        assert(m_size == other.m_size);
+        other.for_each_word([&](size_t word, std::uint64_t bits) {
+            m_words[word] |= bits;
+            m_summary[word / bits_per_word] |= std::uint64_t{1} << (word % bits_per_word);
+        });
+        return *this;
+    }
+
+    /// this = this & ~other, only words non-zero in both are touched.
+    BasicHierarchicalBitset &and_not(BasicHierarchicalBitset const &other)
+    {
+        assert(m_size == other.m_size);
+        for (size_t summary = 0; summary < m_summary.size(); ++summary) {
+            auto const common = m_summary[summary] & other.m_summary[summary];
+            for_each_set_bit(common, summary * bits_per_word, [&](size_t word) {
+                m_words[word] &= ~other.m_words[word];
+                update_summary(word);
+            });
+        }
+        return *this;
+    }
+
+    /// Calls operation(word, bits) for every non-zero word.
+    template<typename Operation>
+    void for_each_word(Operation operation) const
+    {
+        for (size_t summary = 0; summary < m_summary.size(); ++summary) {
+            for_each_set_bit(m_summary[summary], summary * bits_per_word, [&](size_t word) {
+                operation(word, m_words[word]);
+            });
+        }
+    }
+
+    /// Calls operation(pos) for every set bit in ascending order.
+    template<typename Operation>
+    void for_each(Operation operation) const
+    {
+        for_each_word([&operation](size_t word, std::uint64_t bits) {
+            for_each_set_bit(bits, word * bits_per_word, operation);
+        });
+    }
+
+private:
+    inline void update_summary(size_t word)
+    {
+        auto const bit = std::uint64_t{1} << (word % bits_per_word);
+        auto &summary = m_summary[word / bits_per_word];
+        summary = (m_words[word] != 0) ? (summary | bit) : (summary & ~bit);
+    }
+};
+
+template<typename AllocT>
+BasicHierarchicalBitset<AllocT> operator&(BasicHierarchicalBitset<AllocT> lhs,
+                                          BasicHierarchicalBitset<AllocT> const &rhs)
+{
+    return lhs &= rhs;
+}
+
+template<typename AllocT>
+BasicHierarchicalBitset<AllocT> operator|(BasicHierarchicalBitset<AllocT> lhs,
+                                          BasicHierarchicalBitset<AllocT> const &rhs)
+{
+    return lhs |= rhs;
+}
+
+template<typename AllocT>
+BasicHierarchicalBitset<AllocT> and_not(BasicHierarchicalBitset<AllocT> lhs,
+                                        BasicHierarchicalBitset<AllocT> const &rhs)
+{
+    return lhs.and_not(rhs);
+}
+
+using HierarchicalBitset = BasicHierarchicalBitset<>;
+
+namespace pmr
+{
+using HierarchicalBitset
+    = cpputility::BasicHierarchicalBitset<std::pmr::polymorphic_allocator<std::uint64_t>>;
+} // namespace pmr
+} // namespace cpputility
+
+#endif // CPPUTILITY_CONTAINERS_HIERARCHICAL_BITSET_HPP
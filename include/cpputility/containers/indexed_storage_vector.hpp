@@ -0,0 +1,227 @@
+/* NetSim Project - Numerical Simulation, Analysis and Optimization of District Heating Networks
+ *
+ * include/cpputility/containers/indexed_storage_vector.hpp
+ *
+ * created: 2026-10-19, Dominik Linn <d.linn@gmx.net> <dominik.linn@itwm.fraunhofer.de>
+ *
+ * (c) 2026 Dominik Linn, Fraunhofer ITWM
+ *
+ */
+
+#ifndef CPPUTILITY_CONTAINERS_INDEXED_STORAGE_VECTOR_HPP
+#define CPPUTILITY_CONTAINERS_INDEXED_STORAGE_VECTOR_HPP
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <cpputility/containers/flat_hash_index.hpp>
+#include <cpputility/containers/storage_vector.hpp>
+#include <cpputility/containers/vector_base.hpp>
+#include <cpputility/trace.hpp>
+
+namespace cpputility
+{
+/// StorageVector with one FlatHashIndex per projection, mapping the projected key of every element
+/// (e.g. its external id) to the element.
+///
+/// Projections are anything std::invoke accepts with a BaseT const &, lambdas as well as member
+/// (function) pointers. Since StorageVector never moves its objects, the indexes store plain
+/// pointers and stay valid when elements are inserted or erased in the middle. The indexes
+/// allocate from the allocator of the storage. The keys of every index have to be unique,
+/// inserting an element with a present key throws std::invalid_argument and leaves the vector
+/// unchanged. Keys must not change while an element is stored, after modifying keys call
+/// rebuild_indexes().
+template<class StorageT, typename... Projections>
+class IndexedStorageVector
+    : public VectorBase<IndexedStorageVector<StorageT, Projections...>,
+                        typename StorageT::value_type>
+{
+public:
+    using value_type = typename StorageT::value_type;
+    using storage_type = StorageT;
+    using pointer_type = typename StorageT::pointer_vector::value_type;
+    using base_type = VectorBase<IndexedStorageVector<StorageT, Projections...>, value_type>;
+    using iterator = typename base_type::iterator;
+    using const_iterator = typename base_type::const_iterator;
+
+    template<size_t Index>
+    using key_type = std::decay_t<
+        std::invoke_result_t<std::tuple_element_t<Index, std::tuple<Projections...>>,
+                             value_type const &>>;
+
+private:
+    template<typename Projection>
+    using projected_key_type
+        = std::decay_t<std::invoke_result_t<Projection, value_type const &>>;
+
+    template<typename Projection>
+    using index_type = FlatHashIndex<
+        projected_key_type<Projection>,
+        value_type *,
+        std::hash<projected_key_type<Projection>>,
+        std::equal_to<projected_key_type<Projection>>,
+        typename std::allocator_traits<typename StorageT::allocator_type>::template rebind_alloc<
+            std::pair<projected_key_type<Projection> const, value_type *>>>;
+
+    using index_tuple = std::tuple<index_type<Projections>...>;
+
+    StorageT m_storage;
+    std::tuple<Projections...> m_projections;
+    index_tuple m_indexes;
+
+public:
+    explicit IndexedStorageVector(Projections... projections)
+        : m_projections{std::move(projections)...}, m_indexes{make_indexes()}
+    {
+    }
+
+    /// Indexes the elements of storage, throws std::invalid_argument if keys are not unique.
+    IndexedStorageVector(StorageT &&storage, Projections... projections)
+        : m_storage{std::move(storage)}, m_projections{std::move(projections)...},
+          m_indexes{make_indexes()}
+    {
+        rebuild_indexes();
+    }
+
+    inline value_type &get(ptrdiff_t pos) const { return m_storage.get(static_cast<size_t>(pos)); }
+
+    inline value_type &get_front() const { return m_storage.get_front(); }
+
+    inline value_type &get_back() const { return m_storage.get_back(); }
+
+    inline ptrdiff_t get_size() const { return m_storage.size(); }
+
+    /// The underlying storage, read-only since modifying it would bypass the indexes.
+    inline StorageT const &storage() const { return m_storage; }
+
+    void reserve(size_t size)
+    {
+        m_storage.get_pointers().reserve(size);
+        for_each_index(m_indexes, [size](auto &index, auto const &) { index.reserve(size); });
+    }
+
+    void clear()
+    {
+        m_storage.clear();
+        for_each_index(m_indexes, [](auto &index, auto const &) { index.clear(); });
+    }
+
+    /// Appends value, throws std::invalid_argument (and keeps value) if one of its keys is present.
+    void emplace_back(pointer_type &&value)
+    {
+        check_unique(*value);
+        auto &element = *value;
+        m_storage.emplace_back(std::move(value));
+        add_to_indexes(m_indexes, element);
+    }
+
+    /// Inserts value before position, throws like emplace_back.
+    void emplace(iterator position, pointer_type &&value)
+    {
+        check_unique(*value);
+        auto &element = *value;
+        m_storage.emplace(m_storage.begin() + (position - this->begin()), std::move(value));
+        add_to_indexes(m_indexes, element);
+    }
+
+    /// Removes the element at position from the indexes and destroys it.
+    void erase(iterator position)
+    {
+        auto &element = *position;
+        for_each_index(m_indexes, [&element](auto &index, auto const &projection) {
+            index.erase(std::invoke(projection, std::as_const(element)));
+        });
+        m_storage.erase(m_storage.begin() + (position - this->begin()));
+    }
+
+    /// Element whose key in index Index equals key, nullptr if there is none.
+    template<size_t Index = 0>
+    value_type *find(key_type<Index> const &key) const
+    {
+        auto const *element = std::get<Index>(m_indexes).find(key);
+        return element == nullptr ? nullptr : *element;
+    }
+
+    template<size_t Index = 0>
+    inline bool contains(key_type<Index> const &key) const
+    {
+        return std::get<Index>(m_indexes).contains(key);
+    }
+
+    /// Rebuilds all indexes from scratch, after bulk changes of keys or of the storage. Throws
+    /// std::invalid_argument if keys are not unique, the previous indexes are kept then.
+    void rebuild_indexes()
+    {
+        CPPUTILITY_TRACE_SCOPE("cpputility::IndexedStorageVector::rebuild_indexes");
+        auto indexes = make_indexes();
+        auto const size = static_cast<size_t>(m_storage.size());
+        for_each_index(indexes, [size](auto &index, auto const &) { index.reserve(size); });
+        for (auto &element : m_storage) {
+            if (!add_to_indexes(indexes, element)) {
+                throw std::invalid_argument(
+                    "cpputility::IndexedStorageVector::rebuild_indexes: duplicate key");
+            }
+        }
+        m_indexes = std::move(indexes);
+    }
+
+private:
+    index_tuple make_indexes() const
+    {
+        auto const allocator = m_storage.get_allocator();
+        return index_tuple{index_type<Projections>(
+            typename index_type<Projections>::allocator_type(allocator))...};
+    }
+
+    /// Calls operation(index, projection) for every index of indexes.
+    template<typename Operation>
+    void for_each_index(index_tuple &indexes, Operation operation)
+    {
+        for_each_index(indexes, operation, std::index_sequence_for<Projections...>{});
+    }
+
+    template<typename Operation, size_t... Indices>
+    void for_each_index(index_tuple &indexes, Operation &operation, std::index_sequence<Indices...>)
+    {
+        (operation(std::get<Indices>(indexes), std::get<Indices>(m_projections)), ...);
+    }
+
+    /// Throws before anything is modified if a key of element is present in its index.
+    void check_unique(value_type const &element)
+    {
+        bool unique = true;
+        for_each_index(m_indexes, [&](auto &index, auto const &projection) {
+            unique = unique && !index.contains(std::invoke(projection, element));
+        });
+        if (!unique) {
+            throw std::invalid_argument("cpputility::IndexedStorageVector: duplicate key");
+        }
+    }
+
+    /// Adds element to all indexes, returns false if one of its keys was present.
+    bool add_to_indexes(index_tuple &indexes, value_type &element)
+    {
+        bool unique = true;
+        for_each_index(indexes, [&](auto &index, auto const &projection) {
+            unique = index.insert(std::invoke(projection, std::as_const(element)), &element)
+                     && unique;
+        });
+        return unique;
+    }
+};
+
+/// IndexedStorageVector on a StorageVector<BaseT>, e.g.
+/// make_indexed_storage_vector<Pipe>(&Pipe::id, [](Pipe const &pipe) { return pipe.name(); }).
+template<typename BaseT, typename... Projections>
+auto make_indexed_storage_vector(Projections... projections)
+{
+    return IndexedStorageVector<StorageVector<BaseT>, Projections...>(std::move(projections)...);
+}
+} // namespace cpputility
+
+#endif // CPPUTILITY_CONTAINERS_INDEXED_STORAGE_VECTOR_HPP
@@ -22,53 +22,63 @@ using std::ptrdiff_t;
 using std::size_t;
 
 template<typename BaseT, typename RangeT>
-class Iterator : public std::iterator<std::random_access_iterator_tag, BaseT>
+class Iterator
 {
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = BaseT;
+    using difference_type = ptrdiff_t;
+    using pointer = BaseT *;
+    using reference = BaseT &;
+
 private:
-    RangeT &m_range;
-    size_t m_pos;
+    RangeT *m_range = nullptr;
+    size_t m_pos = 0;
 
 public:
-    Iterator() = delete;
-    explicit Iterator(RangeT &range, size_t start = 0) : m_range{range}
+    constexpr Iterator() = default;
+    constexpr explicit Iterator(RangeT &range, size_t start = 0) : m_range{&range}
     {
-        assert(start <= m_range.size());
+        assert(start <= static_cast<size_t>(m_range->size()));
         m_pos = start;
     }
 
-    Iterator &operator++()
+    constexpr Iterator &operator++()
     {
-        if (m_pos < m_range.size()) {
+        if (m_pos < static_cast<size_t>(m_range->size())) {
             ++m_pos;
         }
         return *this;
     }
 
-    Iterator operator++(int)
+    constexpr Iterator operator++(int)
     {
         Iterator copy = *this;
-        if (m_pos < m_range.size()) {
+        if (m_pos < static_cast<size_t>(m_range->size())) {
             ++m_pos;
         }
         return copy;
     }
 
-    Iterator &operator+=(ptrdiff_t difference)
+    constexpr Iterator &operator+=(ptrdiff_t difference)
     {
         m_pos += difference;
         return *this;
     }
 
-    Iterator operator+(int movement)
+    constexpr Iterator operator+(ptrdiff_t movement) const
     {
-        auto oldPos = m_pos;
-        m_pos += movement;
         auto temp = *this;
-        m_pos = oldPos;
+        temp.m_pos += movement;
         return temp;
     }
 
-    Iterator &operator--()
+    friend constexpr Iterator operator+(ptrdiff_t movement, const Iterator &iter)
+    {
+        return iter + movement;
+    }
+
+    constexpr Iterator &operator--()
     {
         if (m_pos > 0) {
             --m_pos;
@@ -76,7 +86,7 @@ public:
         return *this;
     }
 
-    Iterator operator--(int)
+    constexpr Iterator operator--(int)
     {
         Iterator copy = *this;
         if (m_pos > 0) {
@@ -85,116 +95,130 @@ public:
         return copy;
     }
 
-    Iterator &operator-=(ptrdiff_t difference)
+    constexpr Iterator &operator-=(ptrdiff_t difference)
     {
         m_pos -= difference;
         return *this;
     }
 
-    Iterator operator-(int movement)
+    constexpr Iterator operator-(ptrdiff_t movement) const
     {
-        auto oldPos = m_pos;
-        m_pos -= movement;
         auto temp = *this;
-        m_pos = oldPos;
+        temp.m_pos -= movement;
         return temp;
     }
 
-    ptrdiff_t operator-(const Iterator &iter)
+    constexpr ptrdiff_t operator-(const Iterator &iter) const
     {
-        return static_cast<ptrdiff_t>(this->getPos() - iter.getPos());
+        return static_cast<ptrdiff_t>(m_pos) - static_cast<ptrdiff_t>(iter.m_pos);
     }
 
-    inline bool is_comparable(const Iterator &rhs) const
+    constexpr bool is_comparable(const Iterator &rhs) const
     {
-        return (&m_range == &rhs.m_range) && (m_range.size() == rhs.m_range.size());
+        return (m_range == rhs.m_range) && (m_range->size() == rhs.m_range->size());
     }
 
-    bool operator==(const Iterator &rhs) const
+    constexpr bool operator==(const Iterator &rhs) const
     {
         return is_comparable(rhs) && (m_pos == rhs.m_pos);
     }
 
-    bool operator!=(const Iterator &rhs) const
+    constexpr bool operator!=(const Iterator &rhs) const
     {
         return !is_comparable(rhs) || (m_pos != rhs.m_pos);
     }
 
-    bool operator<(const Iterator &rhs) const { return is_comparable(rhs) && (m_pos < rhs.m_pos); }
+    constexpr bool operator<(const Iterator &rhs) const
+    {
+        return is_comparable(rhs) && (m_pos < rhs.m_pos);
+    }
 
-    bool operator<=(const Iterator &rhs) const
+    constexpr bool operator<=(const Iterator &rhs) const
     {
         return is_comparable(rhs) && (m_pos <= rhs.m_pos);
     }
 
-    bool operator>(const Iterator &rhs) const { return is_comparable(rhs) && (m_pos > rhs.m_pos); }
+    constexpr bool operator>(const Iterator &rhs) const
+    {
+        return is_comparable(rhs) && (m_pos > rhs.m_pos);
+    }
 
-    bool operator>=(const Iterator &rhs) const
+    constexpr bool operator>=(const Iterator &rhs) const
     {
         return is_comparable(rhs) && (m_pos >= rhs.m_pos);
     }
 
-    BaseT &operator*() { return m_range[m_pos]; }
+    constexpr BaseT &operator*() const { return (*m_range)[m_pos]; }
 
-    const BaseT &operator*() const { return m_range[m_pos]; }
+    constexpr BaseT &operator[](ptrdiff_t offset) const { return (*m_range)[m_pos + offset]; }
 
-    BaseT *operator->() { return &m_range[m_pos]; }
+    constexpr BaseT *operator->() const { return &(*m_range)[m_pos]; }
 
-    BaseT *getPtr() const { return &m_range[m_pos]; }
+    constexpr BaseT *getPtr() const { return &(*m_range)[m_pos]; }
 
-    size_t getPos() const { return m_pos; }
+    constexpr size_t getPos() const { return m_pos; }
 
-    const BaseT *getConstPtr() const { return &m_range[m_pos]; }
+    constexpr const BaseT *getConstPtr() const { return &(*m_range)[m_pos]; }
 };
 
 template<typename BaseT, typename RangeT>
-class ConstIterator : public std::iterator<std::random_access_iterator_tag, BaseT>
+class ConstIterator
 {
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = BaseT;
+    using difference_type = ptrdiff_t;
+    using pointer = const BaseT *;
+    using reference = const BaseT &;
+
 private:
-    const RangeT &m_range;
-    size_t m_pos;
+    const RangeT *m_range = nullptr;
+    size_t m_pos = 0;
 
 public:
-    ConstIterator() = delete;
-    ConstIterator(const RangeT &range, size_t start = 0) : m_range{range}
+    constexpr ConstIterator() = default;
+    constexpr ConstIterator(const RangeT &range, size_t start = 0) : m_range{&range}
     {
-        assert(start <= m_range.size());
+        assert(start <= static_cast<size_t>(m_range->size()));
         m_pos = start;
     }
 
-    ConstIterator &operator++()
+    constexpr ConstIterator &operator++()
     {
-        if (m_pos < m_range.size()) {
+        if (m_pos < static_cast<size_t>(m_range->size())) {
             ++m_pos;
         }
         return *this;
     }
 
-    ConstIterator operator++(int)
+    constexpr ConstIterator operator++(int)
     {
         ConstIterator copy = *this;
-        if (m_pos < m_range.size()) {
+        if (m_pos < static_cast<size_t>(m_range->size())) {
             ++m_pos;
         }
         return copy;
     }
 
-    ConstIterator &operator+=(ptrdiff_t difference)
+    constexpr ConstIterator &operator+=(ptrdiff_t difference)
     {
         m_pos += difference;
         return *this;
     }
 
-    ConstIterator operator+(int movement)
+    constexpr ConstIterator operator+(ptrdiff_t movement) const
     {
-        auto oldPos = m_pos;
-        m_pos += movement;
         auto temp = *this;
-        m_pos = oldPos;
+        temp.m_pos += movement;
         return temp;
     }
 
-    ConstIterator &operator--()
+    friend constexpr ConstIterator operator+(ptrdiff_t movement, const ConstIterator &iter)
+    {
+        return iter + movement;
+    }
+
+    constexpr ConstIterator &operator--()
     {
         if (m_pos > 0) {
             --m_pos;
@@ -202,7 +226,7 @@ public:
         return *this;
     }
 
-    ConstIterator operator--(int)
+    constexpr ConstIterator operator--(int)
     {
         ConstIterator copy = *this;
         if (m_pos > 0) {
@@ -211,72 +235,73 @@ public:
         return copy;
     }
 
-    ConstIterator &operator-=(ptrdiff_t difference)
+    constexpr ConstIterator &operator-=(ptrdiff_t difference)
     {
         m_pos -= difference;
         return *this;
     }
 
-    ConstIterator operator-(int movement)
+    constexpr ConstIterator operator-(ptrdiff_t movement) const
     {
-        auto oldPos = m_pos;
-        m_pos -= movement;
         auto temp = *this;
-        m_pos = oldPos;
+        temp.m_pos -= movement;
         return temp;
     }
 
-    ptrdiff_t operator-(const ConstIterator &iter)
+    constexpr ptrdiff_t operator-(const ConstIterator &iter) const
     {
-        return static_cast<ptrdiff_t>(this->getPos() - iter.getPos());
+        return static_cast<ptrdiff_t>(m_pos) - static_cast<ptrdiff_t>(iter.m_pos);
     }
 
-    inline bool is_comparable(const ConstIterator &rhs) const
+    constexpr bool is_comparable(const ConstIterator &rhs) const
     {
-        return (&m_range == &rhs.m_range) && (m_range.size() == rhs.m_range.size());
+        return (m_range == rhs.m_range) && (m_range->size() == rhs.m_range->size());
     }
 
-    bool operator==(const ConstIterator &rhs) const
+    constexpr bool operator==(const ConstIterator &rhs) const
     {
         return is_comparable(rhs) && (m_pos == rhs.m_pos);
     }
 
-    bool operator!=(const ConstIterator &rhs) const
+    constexpr bool operator!=(const ConstIterator &rhs) const
     {
         return !is_comparable(rhs) || (m_pos != rhs.m_pos);
     }
 
-    bool operator<(const ConstIterator &rhs) const
+    constexpr bool operator<(const ConstIterator &rhs) const
     {
         return is_comparable(rhs) && (m_pos < rhs.m_pos);
     }
 
-    bool operator<=(const ConstIterator &rhs) const
+    constexpr bool operator<=(const ConstIterator &rhs) const
     {
         return is_comparable(rhs) && (m_pos <= rhs.m_pos);
     }
 
-    bool operator>(const ConstIterator &rhs) const
+    constexpr bool operator>(const ConstIterator &rhs) const
     {
         return is_comparable(rhs) && (m_pos > rhs.m_pos);
     }
 
-    bool operator>=(const ConstIterator &rhs) const
+    constexpr bool operator>=(const ConstIterator &rhs) const
     {
         return is_comparable(rhs) && (m_pos >= rhs.m_pos);
     }
 
-    const BaseT &operator*() { return m_range[m_pos]; }
+    constexpr const BaseT &operator*() const { return (*m_range)[m_pos]; }
 
-    const BaseT &operator*() const { return m_range[m_pos]; }
+    constexpr const BaseT &operator[](ptrdiff_t offset) const
+    {
+        return (*m_range)[m_pos + offset];
+    }
 
-    const BaseT *operator->() { return &m_range[m_pos]; }
+    constexpr const BaseT *operator->() const { return &(*m_range)[m_pos]; }
 
-    size_t getPos() const { return m_pos; }
+    constexpr size_t getPos() const { return m_pos; }
 
-    const BaseT *getPtr() const { return &m_range[m_pos]; }
+    constexpr const BaseT *getPtr() const { return &(*m_range)[m_pos]; }
 
-    const BaseT *getConstPtr() const { return &m_range[m_pos]; }
+    constexpr const BaseT *getConstPtr() const { return &(*m_range)[m_pos]; }
 };
 } // namespace cpputility
 #endif // CPPUTILITY_CONTAINERS_ITERATOR_HPP
@@ -0,0 +1,135 @@
+/* NetSim Project - Numerical Simulation, Analysis and Optimization of District Heating Networks
+ *
+ * include/cpputility/containers/masked_view.hpp
+ *
+ * created: 2026-10-19, Dominik Linn <d.linn@gmx.net> <dominik.linn@itwm.fraunhofer.de>
+ *
+ * (c) 2026 Dominik Linn, Fraunhofer ITWM
+ *
+ */
+
+#ifndef CPPUTILITY_CONTAINERS_MASKED_VIEW_HPP
+#define CPPUTILITY_CONTAINERS_MASKED_VIEW_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include <cpputility/containers/hierarchical_bitset.hpp>
+#include <cpputility/selection.hpp>
+
+namespace cpputility
+{
+/// View onto the active subset of a vector, e.g. the open valves or the active consumers of a
+/// network.
+///
+/// The active elements are stored in a HierarchicalBitset, so (de)activating an element is O(1)
+/// and iterating the active elements costs time proportional to their number instead of the size
+/// of the vector. The mask can be combined with other masks of equal size by &=, |= and and_not.
+template<class VectorT>
+class MaskedView
+{
+private:
+    VectorT *m_base;
+    HierarchicalBitset m_mask;
+
+public:
+    using value_type = typename VectorT::value_type;
+
+    MaskedView() = delete;
+
+    /// Creates a view with no active element.
+    explicit MaskedView(VectorT &array)
+        : m_base{&array}, m_mask(static_cast<size_t>(array.size()))
+    {
+    }
+
+    MaskedView(VectorT &array, HierarchicalBitset mask) : m_base{&array}, m_mask{std::move(mask)}
+    {
+    }
+
+    inline ptrdiff_t size() const { return m_base->size(); }
+
+    inline value_type &operator[](ptrdiff_t pos) { return (*m_base)[pos]; }
+
+    inline value_type const &operator[](ptrdiff_t pos) const { return (*m_base)[pos]; }
+
+    inline HierarchicalBitset &mask() { return m_mask; }
+
+    inline HierarchicalBitset const &mask() const { return m_mask; }
+
+    inline bool is_active(ptrdiff_t pos) const { return m_mask.test(static_cast<size_t>(pos)); }
+
+    inline void activate(ptrdiff_t pos) { m_mask.set(static_cast<size_t>(pos)); }
+
+    inline void deactivate(ptrdiff_t pos) { m_mask.reset(static_cast<size_t>(pos)); }
+
+    inline void activate_all() { m_mask.set_all(); }
+
+    inline void deactivate_all() { m_mask.reset_all(); }
+
+    inline size_t active_count() const { return m_mask.count(); }
+
+    /// Activates exactly the elements satisfying pred.
+    template<typename Predicate>
+    void assign_if(Predicate pred)
+    {
+        m_mask.resize(static_cast<size_t>(size()));
+        for_each_mask_word(static_cast<VectorT const &>(*m_base),
+                           pred,
+                           [this](size_t word, std::uint64_t bits) {
+                               m_mask.set_word(word, bits);
+                           });
+    }
+
+    /// Calls operation(element) for every active element in ascending order.
+    template<typename Operation>
+    void for_each(Operation operation)
+    {
+        m_mask.for_each([&](size_t pos) { operation((*m_base)[static_cast<ptrdiff_t>(pos)]); });
+    }
+
+    template<typename Operation>
+    void for_each(Operation operation) const
+    {
+        m_mask.for_each([&](size_t pos) {
+            operation(static_cast<VectorT const &>(*m_base)[static_cast<ptrdiff_t>(pos)]);
+        });
+    }
+
+    /// Calls operation(pos, element) for every active element in ascending order.
+    template<typename Operation>
+    void for_each_indexed(Operation operation)
+    {
+        m_mask.for_each([&](size_t pos) {
+            operation(static_cast<ptrdiff_t>(pos), (*m_base)[static_cast<ptrdiff_t>(pos)]);
+        });
+    }
+
+    MaskedView &operator&=(HierarchicalBitset const &mask)
+    {
+        m_mask &= mask;
+        return *this;
+    }
+
+    MaskedView &operator|=(HierarchicalBitset const &mask)
+    {
+        m_mask |= mask;
+        return *this;
+    }
+
+    MaskedView &and_not(HierarchicalBitset const &mask)
+    {
+        m_mask.and_not(mask);
+        return *this;
+    }
+};
+
+template<class VectorT>
+auto masked_view(VectorT &vec)
+{
+    return MaskedView<VectorT>(vec);
+}
+
+} // namespace cpputility
+#endif // CPPUTILITY_CONTAINERS_MASKED_VIEW_HPP
@@ -0,0 +1,192 @@
+/* NetSim Project - Numerical Simulation, Analysis and Optimization of District Heating Networks
+ *
+ * include/cpputility/containers/matrix_view.hpp
+ *
+ * created: 2026-10-19, Dominik Linn <d.linn@gmx.net> <dominik.linn@itwm.fraunhofer.de>
+ *
+ * (c) 2026 Dominik Linn, Fraunhofer ITWM
+ *
+ */
+
+#ifndef CPPUTILITY_CONTAINERS_MATRIX_VIEW_HPP
+#define CPPUTILITY_CONTAINERS_MATRIX_VIEW_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+
+#include <cpputility/containers/vector_slice.hpp>
+#include <cpputility/parallel.hpp>
+#include <cpputility/trace.hpp>
+
+namespace cpputility
+{
+/// Default edge length of the square tiles of the blocked kernels, 64 x 64 doubles fill 32kB.
+constexpr ptrdiff_t default_tile_size = 64;
+
+/// Row-major 2D view onto a flat vector (std::vector, VectorView, StaticVector, ...).
+///
+/// Element (row, col) is stored at offset + row * rowStride + col, so a tile of a matrix is again
+/// a MatrixView onto the same vector. Rows are returned as contiguous VectorSlices, columns as
+/// slices with stride rowStride.
+template<class VectorT>
+class MatrixView
+{
+private:
+    VectorT *m_base;
+    ptrdiff_t m_rows;
+    ptrdiff_t m_cols;
+    ptrdiff_t m_rowStride;
+    ptrdiff_t m_offset;
+
+public:
+    using value_type = typename VectorT::value_type;
+
+    MatrixView() = delete;
+
+    MatrixView(VectorT &array, ptrdiff_t rows, ptrdiff_t cols)
+        : MatrixView(array, rows, cols, cols, 0)
+    {
+    }
+
+    MatrixView(VectorT &array,
+               ptrdiff_t rows,
+               ptrdiff_t cols,
+               ptrdiff_t row_stride,
+               ptrdiff_t offset)
+        : m_base{&array}, m_rows{rows}, m_cols{cols}, m_rowStride{row_stride}, m_offset{offset}
+    {
+        assert(cols <= row_stride);
+        assert(rows == 0
+               || offset + (rows - 1) * row_stride + cols <= static_cast<ptrdiff_t>(array.size()));
+    }
+
+    inline ptrdiff_t rows() const { return m_rows; }
+
+    inline ptrdiff_t cols() const { return m_cols; }
+
+    inline ptrdiff_t row_stride() const { return m_rowStride; }
+
+    inline value_type &operator()(ptrdiff_t row, ptrdiff_t col)
+    {
+        return (*m_base)[m_offset + row * m_rowStride + col];
+    }
+
+    inline value_type const &operator()(ptrdiff_t row, ptrdiff_t col) const
+    {
+        return (*m_base)[m_offset + row * m_rowStride + col];
+    }
+
+    auto row(ptrdiff_t row) const
+    {
+        auto const start = m_offset + row * m_rowStride;
+        return VectorSlice<VectorT>(*m_base, start, start + m_cols, 1);
+    }
+
+    auto col(ptrdiff_t col) const
+    {
+        auto const start = m_offset + col;
+        return VectorSlice<VectorT>(*m_base, start, start + m_rows * m_rowStride, m_rowStride);
+    }
+
+    /// Sub-matrix of rows x cols elements starting at (row, col).
+    MatrixView tile(ptrdiff_t row, ptrdiff_t col, ptrdiff_t rows, ptrdiff_t cols) const
+    {
+        assert(row + rows <= m_rows && col + cols <= m_cols);
+        return MatrixView(*m_base, rows, cols, m_rowStride, m_offset + row * m_rowStride + col);
+    }
+
+    /// Calls operation(tile, row, col) for all tiles of at most tile_rows x tile_cols elements in
+    /// row-major tile order, row and col being the position of the tile in this matrix.
+    template<typename Operation>
+    void for_each_tile(ptrdiff_t tile_rows, ptrdiff_t tile_cols, Operation operation) const
+    {
+        for (ptrdiff_t row = 0; row < m_rows; row += tile_rows) {
+            for (ptrdiff_t col = 0; col < m_cols; col += tile_cols) {
+                auto const rows = std::min(tile_rows, m_rows - row);
+                operation(tile(row, col, rows, std::min(tile_cols, m_cols - col)), row, col);
+            }
+        }
+    }
+
+    /// Like for_each_tile, but rows of tiles are distributed over threads. Every thread gets rows of
+    /// tiles with at least default_min_block_size elements, so small matrices stay on the calling
+    /// thread.
+    template<typename Operation>
+    void parallel_for_each_tile(ptrdiff_t tile_rows,
+                                ptrdiff_t tile_cols,
+                                Operation operation,
+                                size_t thread_count = hardware_thread_count()) const
+    {
+        auto const tileRowCount = static_cast<size_t>((m_rows + tile_rows - 1) / tile_rows);
+        auto const tileRowSize = std::max(static_cast<size_t>(tile_rows * m_cols), size_t{1});
+        parallel_for(
+            tileRowCount,
+            [&](size_t tileRow) {
+                auto const row = static_cast<ptrdiff_t>(tileRow) * tile_rows;
+                auto const rows = std::min(tile_rows, m_rows - row);
+                for (ptrdiff_t col = 0; col < m_cols; col += tile_cols) {
+                    operation(tile(row, col, rows, std::min(tile_cols, m_cols - col)), row, col);
+                }
+            },
+            (default_min_block_size + tileRowSize - 1) / tileRowSize,
+            thread_count);
+    }
+};
+
+template<class VectorT>
+auto matrix_view(VectorT &vec, ptrdiff_t rows, ptrdiff_t cols)
+{
+    return MatrixView<VectorT>(vec, rows, cols);
+}
+
+/// Copies source into destination (both of equal shape) tile by tile.
+template<class SourceT, class DestinationT>
+void tiled_copy(MatrixView<SourceT> const &source,
+                MatrixView<DestinationT> const &destination,
+                ptrdiff_t tile_size = default_tile_size,
+                size_t thread_count = hardware_thread_count())
+{
+    CPPUTILITY_TRACE_SCOPE("cpputility::tiled_copy");
+    assert(source.rows() == destination.rows() && source.cols() == destination.cols());
+    source.parallel_for_each_tile(
+        tile_size,
+        tile_size,
+        [&destination](auto const &tile, ptrdiff_t row, ptrdiff_t col) {
+            auto target = destination.tile(row, col, tile.rows(), tile.cols());
+            for (ptrdiff_t r = 0; r < tile.rows(); ++r) {
+                for (ptrdiff_t c = 0; c < tile.cols(); ++c) {
+                    target(r, c) = tile(r, c);
+                }
+            }
+        },
+        thread_count);
+}
+
+/// Writes the transpose of source into destination, which has to be of shape cols x rows. The
+/// matrices are processed in square tiles, so both the reads and the strided writes of a tile stay
+/// in cache.
+template<class SourceT, class DestinationT>
+void tiled_transpose(MatrixView<SourceT> const &source,
+                     MatrixView<DestinationT> const &destination,
+                     ptrdiff_t tile_size = default_tile_size,
+                     size_t thread_count = hardware_thread_count())
+{
+    CPPUTILITY_TRACE_SCOPE("cpputility::tiled_transpose");
+    assert(source.rows() == destination.cols() && source.cols() == destination.rows());
+    source.parallel_for_each_tile(
+        tile_size,
+        tile_size,
+        [&destination](auto const &tile, ptrdiff_t row, ptrdiff_t col) {
+            auto target = destination.tile(col, row, tile.cols(), tile.rows());
+            for (ptrdiff_t r = 0; r < tile.rows(); ++r) {
+                for (ptrdiff_t c = 0; c < tile.cols(); ++c) {
+                    target(c, r) = tile(r, c);
+                }
+            }
+        },
+        thread_count);
+}
+} // namespace cpputility
+
+#endif // CPPUTILITY_CONTAINERS_MATRIX_VIEW_HPP
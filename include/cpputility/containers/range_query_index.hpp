@@ -0,0 +1,237 @@
+/* NetSim Project - Numerical Simulation, Analysis and Optimization of District Heating Networks
+ *
+ * include/cpputility/containers/range_query_index.hpp
+ *
+ * created: 2026-10-19, Dominik Linn <d.linn@gmx.net> <dominik.linn@itwm.fraunhofer.de>
+ *
+ * (c) 2026 Dominik Linn, Fraunhofer ITWM
+ *
+ */
+
+#ifndef CPPUTILITY_CONTAINERS_RANGE_QUERY_INDEX_HPP
+#define CPPUTILITY_CONTAINERS_RANGE_QUERY_INDEX_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include <cpputility/containers/vector_view.hpp>
+#include <cpputility/parallel.hpp>
+#include <cpputility/trace.hpp>
+
+namespace cpputility
+{
+/// Operations of a RangeQueryIndex: an associative operator() and its identity element.
+template<typename T>
+struct RangeSum
+{
+    static constexpr T identity() { return T{}; }
+
+    constexpr T operator()(T const &lhs, T const &rhs) const { return lhs + rhs; }
+};
+
+template<typename T>
+struct RangeMin
+{
+    static constexpr T identity()
+    {
+        return std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                    : std::numeric_limits<T>::max();
+    }
+
+    constexpr T operator()(T const &lhs, T const &rhs) const { return rhs < lhs ? rhs : lhs; }
+};
+
+template<typename T>
+struct RangeMax
+{
+    static constexpr T identity()
+    {
+        return std::numeric_limits<T>::has_infinity ? -std::numeric_limits<T>::infinity()
+                                                    : std::numeric_limits<T>::lowest();
+    }
+
+    constexpr T operator()(T const &lhs, T const &rhs) const { return lhs < rhs ? rhs : lhs; }
+};
+
+/// Segment tree over the elements of a vector, answering op(vec[begin], ..., vec[end - 1]) for
+/// any range in O(log n), e.g. the minimal temperature along a pipe chain.
+///
+/// The tree is stored implicitly in one array: node i has the children 2i and 2i + 1 and the
+/// leaves start at the smallest power of two not less than the size, the unused leaves hold the
+/// identity. The vector is read when the index is (re)built; changes have to go through set(),
+/// or be announced by refresh(), so the affected paths to the root are recomputed.
+template<class VectorT, class OpT = RangeSum<typename VectorT::value_type>>
+class RangeQueryIndex
+{
+public:
+    using value_type = typename VectorT::value_type;
+
+private:
+    VectorView<VectorT> m_view;
+    std::vector<value_type> m_tree;
+    std::vector<size_t> m_dirty;
+    size_t m_leaves = 1;
+    OpT m_op;
+
+public:
+    explicit RangeQueryIndex(VectorT &vec,
+                             size_t thread_count = hardware_thread_count(),
+                             OpT op = OpT{})
+        : m_view{vec}, m_op{op}
+    {
+        rebuild(thread_count);
+    }
+
+    explicit RangeQueryIndex(VectorView<VectorT> view,
+                             size_t thread_count = hardware_thread_count(),
+                             OpT op = OpT{})
+        : m_view{view}, m_op{op}
+    {
+        rebuild(thread_count);
+    }
+
+    inline ptrdiff_t size() const { return m_view.size(); }
+
+    /// op over [begin, end), the identity for an empty range.
+    value_type query(ptrdiff_t begin, ptrdiff_t end) const
+    {
+        assert(0 <= begin && begin <= end && end <= size());
+        auto left = OpT::identity();
+        auto right = OpT::identity();
+        auto first = static_cast<size_t>(begin) + m_leaves;
+        auto last = static_cast<size_t>(end) + m_leaves;
+        for (; first < last; first /= 2, last /= 2) {
+            if (first % 2 == 1) {
+                left = m_op(left, m_tree[first++]);
+            }
+            if (last % 2 == 1) {
+                right = m_op(m_tree[--last], right);
+            }
+        }
+        return m_op(left, right);
+    }
+
+    /// op over all elements.
+    inline value_type total() const { return m_tree[1]; }
+
+    /// vec[pos] = value, updating the index.
+    void set(ptrdiff_t pos, value_type value)
+    {
+        m_view[pos] = value;
+        refresh(pos);
+    }
+
+    /// Applies all (pos, value) pairs of updates, e.g. a vector of std::pair. Every inner node is
+    /// recomputed at most once, however many of its leaves changed.
+    template<class Updates>
+    void set_batch(Updates const &updates)
+    {
+        m_dirty.clear();
+        for (auto const &update : updates) {
+            m_view[update.first] = update.second;
+            m_dirty.push_back(leaf(update.first));
+        }
+        update_dirty();
+    }
+
+    /// Rereads vec[pos] after it was modified directly.
+    void refresh(ptrdiff_t pos)
+    {
+        auto node = leaf(pos);
+        for (node /= 2; node > 0; node /= 2) {
+            m_tree[node] = m_op(m_tree[2 * node], m_tree[2 * node + 1]);
+        }
+    }
+
+    /// Rereads vec[pos] for all pos in positions.
+    template<class Positions>
+    void refresh_batch(Positions const &positions)
+    {
+        m_dirty.clear();
+        for (auto const pos : positions) {
+            m_dirty.push_back(leaf(static_cast<ptrdiff_t>(pos)));
+        }
+        update_dirty();
+    }
+
+    /// Rebuilds the index from the vector, which may have changed arbitrarily (also in size).
+    ///
+    /// The tree is cut into up to thread_count subtrees with at least default_min_block_size
+    /// leaves, which are built concurrently bottom-up, only the few nodes above them are computed
+    /// serially afterwards.
+    void rebuild(size_t thread_count = hardware_thread_count())
+    {
+        CPPUTILITY_TRACE_SCOPE("cpputility::RangeQueryIndex::rebuild");
+        auto const size = static_cast<size_t>(m_view.size());
+        m_leaves = 1;
+        while (m_leaves < size) {
+            m_leaves *= 2;
+        }
+        m_tree.assign(2 * m_leaves, OpT::identity());
+
+        size_t subtrees = 1;
+        while (2 * subtrees <= std::min(thread_count, m_leaves / default_min_block_size)) {
+            subtrees *= 2;
+        }
+
+        parallel_invoke_n(subtrees, [this, size, subtrees](size_t subtree) {
+            auto const width = m_leaves / subtrees;
+            auto const begin = subtree * width;
+            for (auto pos = begin; pos < std::min(begin + width, size); ++pos) {
+                m_tree[m_leaves + pos] = m_view[static_cast<ptrdiff_t>(pos)];
+            }
+            for (auto first = m_leaves + begin, count = width; count > 1; first /= 2, count /= 2) {
+                for (auto node = first / 2; node < (first + count) / 2; ++node) {
+                    m_tree[node] = m_op(m_tree[2 * node], m_tree[2 * node + 1]);
+                }
+            }
+        });
+
+        for (auto node = subtrees; node-- > 1;) {
+            m_tree[node] = m_op(m_tree[2 * node], m_tree[2 * node + 1]);
+        }
+    }
+
+private:
+    /// Copies vec[pos] into its leaf and returns the leaf.
+    inline size_t leaf(ptrdiff_t pos)
+    {
+        assert(0 <= pos && pos < size());
+        auto const node = m_leaves + static_cast<size_t>(pos);
+        m_tree[node] = m_view[pos];
+        return node;
+    }
+
+    /// Recomputes the parents of all nodes in m_dirty level by level; the nodes of one level stay
+    /// sorted, so duplicates are adjacent and skipped.
+    void update_dirty()
+    {
+        std::sort(m_dirty.begin(), m_dirty.end());
+        while (!m_dirty.empty() && m_dirty.front() > 1) {
+            size_t parents = 0;
+            for (auto const node : m_dirty) {
+                auto const parent = node / 2;
+                if (parents == 0 || m_dirty[parents - 1] != parent) {
+                    m_tree[parent] = m_op(m_tree[2 * parent], m_tree[2 * parent + 1]);
+                    m_dirty[parents++] = parent;
+                }
+            }
+            m_dirty.resize(parents);
+        }
+    }
+};
+
+template<class VectorT>
+using RangeSumIndex = RangeQueryIndex<VectorT, RangeSum<typename VectorT::value_type>>;
+
+template<class VectorT>
+using RangeMinIndex = RangeQueryIndex<VectorT, RangeMin<typename VectorT::value_type>>;
+
+template<class VectorT>
+using RangeMaxIndex = RangeQueryIndex<VectorT, RangeMax<typename VectorT::value_type>>;
+} // namespace cpputility
+
+#endif // CPPUTILITY_CONTAINERS_RANGE_QUERY_INDEX_HPP
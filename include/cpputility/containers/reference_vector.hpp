@@ -13,6 +13,8 @@
 
 #include <algorithm>
 #include <functional>
+#include <memory>
+#include <memory_resource>
 #include <vector>
 
 #include <cpputility/algorithms.hpp>
@@ -20,16 +22,19 @@
 
 namespace cpputility
 {
-template<typename BaseT>
-class ReferenceVector : public VectorBase<ReferenceVector<BaseT>, BaseT>
+template<typename BaseT, typename AllocT = std::allocator<std::reference_wrapper<BaseT>>>
+class ReferenceVector : public VectorBase<ReferenceVector<BaseT, AllocT>, BaseT>
 {
-private:
-    std::vector<std::reference_wrapper<BaseT>> m_refs;
-
 public:
     using value_type = BaseT;
     using reference_type = BaseT &;
+    using allocator_type = AllocT;
+    using reference_vector = std::vector<std::reference_wrapper<BaseT>, AllocT>;
 
+private:
+    reference_vector m_refs;
+
+public:
     inline size_t get_size() const { return m_refs.size(); }
 
     inline value_type &get(ptrdiff_t pos) { return std::ref(m_refs[pos]); }
@@ -40,25 +45,34 @@ public:
 
     inline value_type const &get_front() const { return get(0); }
 
-    inline value_type &get_back() { return get(this->size()); }
+    inline value_type &get_back() { return get(this->size() - 1); }
+
+    inline value_type const &get_back() const { return get(this->size() - 1); }
 
-    inline value_type const &get_back() const { return get(this->size()); }
+    inline allocator_type get_allocator() const { return m_refs.get_allocator(); }
+
+    /// References to the elements, reordering them reorders the vector without touching objects.
+    reference_vector &get_references() { return m_refs; }
+
+    reference_vector const &get_references() const { return m_refs; }
 
     ReferenceVector() = default;
 
+    explicit ReferenceVector(AllocT const &allocator) : m_refs(allocator) {}
+
     ReferenceVector(ReferenceVector const &other) : m_refs{other.m_refs} {}
 
     ReferenceVector(ReferenceVector &&other) : m_refs{std::move(other.m_refs)} {}
 
     ReferenceVector &operator=(ReferenceVector const &rhs)
     {
-        std::copy(rhs.m_refs.begin(), rhs.m_refs.end(), m_refs.begin());
+        m_refs = rhs.m_refs;
         return *this;
     }
 
     ReferenceVector &operator=(ReferenceVector &&rhs)
     {
-        if (*this != &rhs) {
+        if (this != &rhs) {
             m_refs = std::move(rhs.m_refs);
         }
         return *this;
@@ -82,5 +96,13 @@ public:
     void emplace_back(BaseT &value) { m_refs.emplace_back(std::ref(value)); }
 };
 
+namespace pmr
+{
+template<typename BaseT>
+using ReferenceVector
+    = cpputility::ReferenceVector<BaseT,
+                                  std::pmr::polymorphic_allocator<std::reference_wrapper<BaseT>>>;
+} // namespace pmr
+
 } // namespace cpputility
 #endif // CPPUTILITY_CONTAINERS_REFERENCE_VECTOR_HPP
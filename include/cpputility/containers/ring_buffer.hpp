@@ -0,0 +1,364 @@
+/* NetSim Project - Numerical Simulation, Analysis and Optimization of District Heating Networks
+ *
+ * include/cpputility/containers/ring_buffer.hpp
+ *
+ * created: 2026-10-19, Dominik Linn <d.linn@gmx.net> <dominik.linn@itwm.fraunhofer.de>
+ *
+ * (c) 2026 Dominik Linn, Fraunhofer ITWM
+ *
+ */
+
+#ifndef CPPUTILITY_CONTAINERS_RING_BUFFER_HPP
+#define CPPUTILITY_CONTAINERS_RING_BUFFER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+#include <cpputility/containers/iterator.hpp>
+#include <cpputility/containers/vector_base.hpp>
+
+namespace cpputility
+{
+constexpr size_t cache_line_size = 64;
+
+/// Contiguous slots of a ring buffer, either claimed for writing or available for reading.
+template<typename BaseT>
+class RingBufferRegion : public VectorBase<RingBufferRegion<BaseT>, BaseT>
+{
+private:
+    BaseT *m_data = nullptr;
+    size_t m_size = 0;
+    size_t m_position = 0;
+
+public:
+    using value_type = BaseT;
+
+    RingBufferRegion() = default;
+
+    RingBufferRegion(BaseT *data, size_t size, size_t position)
+        : m_data{data}, m_size{size}, m_position{position}
+    {
+    }
+
+    inline value_type &get(ptrdiff_t pos) { return m_data[pos]; }
+
+    inline value_type const &get(ptrdiff_t pos) const { return m_data[pos]; }
+
+    inline value_type &get_front() { return m_data[0]; }
+
+    inline value_type const &get_front() const { return m_data[0]; }
+
+    inline value_type &get_back() { return m_data[m_size - 1]; }
+
+    inline value_type const &get_back() const { return m_data[m_size - 1]; }
+
+    inline ptrdiff_t get_size() const { return static_cast<ptrdiff_t>(m_size); }
+
+    inline BaseT *data() const { return m_data; }
+
+    /// Absolute position of the first slot in the stream of the ring buffer.
+    inline size_t position() const { return m_position; }
+};
+
+/// Batch and single element operations shared by the ring buffers, implemented on top of the
+/// claim/commit (producer) and peek/release (consumer) operations of Derived.
+template<typename Derived, typename BaseT>
+class RingBufferBase
+{
+public:
+    using value_type = BaseT;
+    using region_type = RingBufferRegion<BaseT>;
+
+    template<typename ValueT>
+    bool try_push(ValueT &&value)
+    {
+        auto &derived = static_cast<Derived &>(*this);
+        auto region = derived.claim(1);
+        if (region.empty()) {
+            return false;
+        }
+        region[0] = std::forward<ValueT>(value);
+        derived.commit(region);
+        return true;
+    }
+
+    bool try_pop(BaseT &value)
+    {
+        auto &derived = static_cast<Derived &>(*this);
+        auto region = derived.peek(1);
+        if (region.empty()) {
+            return false;
+        }
+        value = std::move(region[0]);
+        derived.release(region);
+        return true;
+    }
+
+    /// Copies as many elements of values (e.g. a VectorView or VectorSlice) into the buffer as
+    /// fit, returns their number. Never blocks.
+    template<typename Container>
+    size_t push(Container const &values)
+    {
+        auto &derived = static_cast<Derived &>(*this);
+        auto const size = static_cast<size_t>(values.size());
+        size_t pushed = 0;
+        while (pushed < size) {
+            auto region = derived.claim(size - pushed);
+            if (region.empty()) {
+                break;
+            }
+            for (ptrdiff_t pos = 0; pos < region.size(); ++pos) {
+                region[pos] = values[static_cast<ptrdiff_t>(pushed) + pos];
+            }
+            pushed += static_cast<size_t>(region.size());
+            derived.commit(region);
+        }
+        return pushed;
+    }
+
+    /// Moves up to values.size() elements out of the buffer into values, returns their number.
+    /// Never blocks.
+    template<typename Container>
+    size_t pop(Container &&values)
+    {
+        auto &derived = static_cast<Derived &>(*this);
+        auto const size = static_cast<size_t>(values.size());
+        size_t popped = 0;
+        while (popped < size) {
+            auto region = derived.peek(size - popped);
+            if (region.empty()) {
+                break;
+            }
+            for (ptrdiff_t pos = 0; pos < region.size(); ++pos) {
+                values[static_cast<ptrdiff_t>(popped) + pos] = std::move(region[pos]);
+            }
+            popped += static_cast<size_t>(region.size());
+            derived.release(region);
+        }
+        return popped;
+    }
+
+protected:
+    static size_t round_capacity(size_t capacity)
+    {
+        size_t result = 1;
+        while (result < capacity) {
+            result *= 2;
+        }
+        return result;
+    }
+};
+
+/// Bounded lock-free ring buffer for a single producer and a single consumer thread.
+///
+/// The producer claims contiguous slots, fills them in place and commits them, the consumer peeks
+/// at contiguous filled slots and releases them after use. Neither side ever blocks, claim and
+/// peek return an empty region if the buffer is full or empty respectively. The capacity is
+/// rounded up to a power of two.
+template<typename BaseT, typename AllocT = std::allocator<BaseT>>
+class SpscRingBuffer : public RingBufferBase<SpscRingBuffer<BaseT, AllocT>, BaseT>
+{
+public:
+    using region_type = RingBufferRegion<BaseT>;
+    using allocator_type = AllocT;
+
+private:
+    std::vector<BaseT, AllocT> m_slots;
+    size_t m_mask;
+
+    // producer side, cachedHead avoids reading the consumer cache line on every claim
+    alignas(cache_line_size) std::atomic<size_t> m_tail{0};
+    size_t m_cachedHead = 0;
+
+    // consumer side
+    alignas(cache_line_size) std::atomic<size_t> m_head{0};
+    size_t m_cachedTail = 0;
+
+public:
+    explicit SpscRingBuffer(size_t capacity, AllocT const &allocator = AllocT{})
+        : m_slots(SpscRingBuffer::round_capacity(capacity), allocator),
+          m_mask{m_slots.size() - 1}
+    {
+    }
+
+    SpscRingBuffer(SpscRingBuffer const &) = delete;
+
+    SpscRingBuffer &operator=(SpscRingBuffer const &) = delete;
+
+    inline allocator_type get_allocator() const { return m_slots.get_allocator(); }
+
+    inline size_t capacity() const { return m_slots.size(); }
+
+    /// Number of committed and not yet released elements, exact only if both sides are idle.
+    inline size_t size() const
+    {
+        return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
+    }
+
+    inline bool empty() const { return size() == 0; }
+
+    /// Claims up to count contiguous free slots. Only one claim may be outstanding at a time.
+    region_type claim(size_t count)
+    {
+        auto const tail = m_tail.load(std::memory_order_relaxed);
+        if (capacity() - (tail - m_cachedHead) < count) {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+        }
+        auto const size = std::min({count,
+                                    capacity() - (tail - m_cachedHead),
+                                    capacity() - (tail & m_mask)});
+        return region_type(m_slots.data() + (tail & m_mask), size, tail);
+    }
+
+    /// Publishes the slots of a claimed region.
+    void commit(region_type const &region)
+    {
+        assert(region.position() == m_tail.load(std::memory_order_relaxed));
+        m_tail.store(region.position() + static_cast<size_t>(region.size()),
+                     std::memory_order_release);
+    }
+
+    /// Returns up to count contiguous filled slots.
+    region_type peek(size_t count = std::numeric_limits<size_t>::max())
+    {
+        auto const head = m_head.load(std::memory_order_relaxed);
+        if (m_cachedTail - head < count) {
+            m_cachedTail = m_tail.load(std::memory_order_acquire);
+        }
+        auto const size = std::min({count, m_cachedTail - head, capacity() - (head & m_mask)});
+        return region_type(m_slots.data() + (head & m_mask), size, head);
+    }
+
+    /// Frees the slots of the region for the producer.
+    void release(region_type const &region)
+    {
+        assert(region.position() == m_head.load(std::memory_order_relaxed));
+        m_head.store(region.position() + static_cast<size_t>(region.size()),
+                     std::memory_order_release);
+    }
+};
+
+/// Bounded lock-free ring buffer for several producer threads and a single consumer thread.
+///
+/// Producers reserve contiguous slots with a single compare-and-swap, fill them in place and
+/// commit them by publishing a per slot sequence number, so producers never wait for each other.
+/// The consumer reads filled slots in order; a claimed but not yet committed region holds back
+/// the consumer until it is committed. The capacity is rounded up to a power of two.
+template<typename BaseT, typename AllocT = std::allocator<BaseT>>
+class MpscRingBuffer : public RingBufferBase<MpscRingBuffer<BaseT, AllocT>, BaseT>
+{
+public:
+    using region_type = RingBufferRegion<BaseT>;
+    using allocator_type = AllocT;
+
+private:
+    using sequence_allocator_type =
+        typename std::allocator_traits<AllocT>::template rebind_alloc<std::atomic<size_t>>;
+
+    std::vector<BaseT, AllocT> m_slots;
+    std::vector<std::atomic<size_t>, sequence_allocator_type> m_sequences;
+    size_t m_mask;
+
+    alignas(cache_line_size) std::atomic<size_t> m_tail{0};
+
+    alignas(cache_line_size) std::atomic<size_t> m_head{0};
+
+public:
+    explicit MpscRingBuffer(size_t capacity, AllocT const &allocator = AllocT{})
+        : m_slots(MpscRingBuffer::round_capacity(capacity), allocator),
+          m_sequences(m_slots.size(), sequence_allocator_type(allocator)),
+          m_mask{m_slots.size() - 1}
+    {
+        // slot at position p is filled once its sequence is p + 1
+        for (size_t slot = 0; slot < m_slots.size(); ++slot) {
+            m_sequences[slot].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    MpscRingBuffer(MpscRingBuffer const &) = delete;
+
+    MpscRingBuffer &operator=(MpscRingBuffer const &) = delete;
+
+    inline allocator_type get_allocator() const { return m_slots.get_allocator(); }
+
+    inline size_t capacity() const { return m_slots.size(); }
+
+    /// Number of claimed and not yet released elements, exact only if all sides are idle.
+    inline size_t size() const
+    {
+        return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
+    }
+
+    inline bool empty() const { return size() == 0; }
+
+    /// Claims up to count contiguous free slots, safe to call from several threads.
+    region_type claim(size_t count)
+    {
+        auto tail = m_tail.load(std::memory_order_relaxed);
+        while (true) {
+            auto const head = m_head.load(std::memory_order_acquire);
+            auto const size = std::min({count,
+                                        capacity() - (tail - head),
+                                        capacity() - (tail & m_mask)});
+            if (size == 0) {
+                return region_type(nullptr, 0, tail);
+            }
+            if (m_tail.compare_exchange_weak(tail,
+                                             tail + size,
+                                             std::memory_order_relaxed,
+                                             std::memory_order_relaxed)) {
+                return region_type(m_slots.data() + (tail & m_mask), size, tail);
+            }
+        }
+    }
+
+    /// Publishes all slots of a claimed region, the region must not be shrunk.
+    void commit(region_type const &region)
+    {
+        for (size_t offset = 0; offset < static_cast<size_t>(region.size()); ++offset) {
+            auto const position = region.position() + offset;
+            m_sequences[position & m_mask].store(position + 1, std::memory_order_release);
+        }
+    }
+
+    /// Returns up to count contiguous committed slots.
+    region_type peek(size_t count = std::numeric_limits<size_t>::max())
+    {
+        auto const head = m_head.load(std::memory_order_relaxed);
+        auto const limit = std::min(count, capacity() - (head & m_mask));
+        size_t size = 0;
+        while (size < limit
+               && m_sequences[(head + size) & m_mask].load(std::memory_order_acquire)
+                      == head + size + 1) {
+            ++size;
+        }
+        return region_type(m_slots.data() + (head & m_mask), size, head);
+    }
+
+    /// Frees the slots of the region for the producers.
+    void release(region_type const &region)
+    {
+        assert(region.position() == m_head.load(std::memory_order_relaxed));
+        m_head.store(region.position() + static_cast<size_t>(region.size()),
+                     std::memory_order_release);
+    }
+};
+
+namespace pmr
+{
+template<typename BaseT>
+using SpscRingBuffer = cpputility::SpscRingBuffer<BaseT, std::pmr::polymorphic_allocator<BaseT>>;
+
+template<typename BaseT>
+using MpscRingBuffer = cpputility::MpscRingBuffer<BaseT, std::pmr::polymorphic_allocator<BaseT>>;
+} // namespace pmr
+
+} // namespace cpputility
+#endif // CPPUTILITY_CONTAINERS_RING_BUFFER_HPP
@@ -0,0 +1,334 @@
+/* NetSim Project - Numerical Simulation, Analysis and Optimization of District Heating Networks
+ *
+ * include/cpputility/containers/sparse_vector.hpp
+ *
+ * created: 2026-10-19, Dominik Linn <d.linn@gmx.net> <dominik.linn@itwm.fraunhofer.de>
+ *
+ * (c) 2026 Dominik Linn, Fraunhofer ITWM
+ *
+ */
+
+#ifndef CPPUTILITY_CONTAINERS_SPARSE_VECTOR_HPP
+#define CPPUTILITY_CONTAINERS_SPARSE_VECTOR_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cpputility/containers/iterator.hpp>
+#include <cpputility/containers/vector_base.hpp>
+
+namespace cpputility
+{
+/// Sparse vector of a fixed dimension, storing the non-zero entries as sorted index and value
+/// arrays.
+///
+/// The read interface is the one of a ConstVectorBase, get(pos) returns the stored value or a
+/// reference to zero, so a SparseVector can be passed wherever a read-only dense vector is
+/// expected. Algorithms which should scale with the number of non-zeros use indices() and
+/// values() or the free functions below.
+template<typename BaseT, typename AllocT = std::allocator<BaseT>>
+class SparseVector : public ConstVectorBase<SparseVector<BaseT, AllocT>, BaseT>
+{
+public:
+    using value_type = BaseT;
+    using allocator_type = AllocT;
+    using index_allocator_type
+        = typename std::allocator_traits<AllocT>::template rebind_alloc<ptrdiff_t>;
+    using index_vector = std::vector<ptrdiff_t, index_allocator_type>;
+    using value_vector = std::vector<BaseT, AllocT>;
+
+private:
+    index_vector m_indices;
+    value_vector m_values;
+    ptrdiff_t m_size = 0;
+    BaseT m_zero{};
+
+public:
+    SparseVector() = default;
+
+    explicit SparseVector(ptrdiff_t size, AllocT const &allocator = AllocT{})
+        : m_indices(index_allocator_type(allocator)), m_values(allocator),
+          m_size{size}
+    {
+    }
+
+    inline allocator_type get_allocator() const { return m_values.get_allocator(); }
+
+    inline ptrdiff_t get_size() const { return m_size; }
+
+    value_type const &get(ptrdiff_t pos) const
+    {
+        auto const iter = std::lower_bound(m_indices.begin(), m_indices.end(), pos);
+        if (iter == m_indices.end() || *iter != pos) {
+            return m_zero;
+        }
+        return m_values[static_cast<size_t>(iter - m_indices.begin())];
+    }
+
+    inline value_type const &get_front() const { return get(0); }
+
+    inline value_type const &get_back() const { return get(m_size - 1); }
+
+    inline size_t nonzeros() const { return m_indices.size(); }
+
+    inline index_vector const &indices() const { return m_indices; }
+
+    inline value_vector const &values() const { return m_values; }
+
+    /// Values may be modified in place, the sparsity pattern only through the members below.
+    inline value_vector &values() { return m_values; }
+
+    void resize(ptrdiff_t size)
+    {
+        auto const end = std::lower_bound(m_indices.begin(), m_indices.end(), size);
+        auto const nonzeros = static_cast<size_t>(end - m_indices.begin());
+        m_indices.resize(nonzeros);
+        m_values.resize(nonzeros);
+        m_size = size;
+    }
+
+    void clear()
+    {
+        m_indices.clear();
+        m_values.clear();
+    }
+
+    void reserve(size_t nonzeros)
+    {
+        m_indices.reserve(nonzeros);
+        m_values.reserve(nonzeros);
+    }
+
+    /// Appends an entry, pos has to be larger than all stored indices.
+    void push_back(ptrdiff_t pos, BaseT value)
+    {
+        assert(pos < m_size && (m_indices.empty() || m_indices.back() < pos));
+        m_indices.push_back(pos);
+        m_values.push_back(std::move(value));
+    }
+
+    /// Sets the entry at pos, inserting it into the pattern if necessary.
+    void set(ptrdiff_t pos, BaseT value)
+    {
+        assert(pos < m_size);
+        auto const iter = std::lower_bound(m_indices.begin(), m_indices.end(), pos);
+        auto const offset = iter - m_indices.begin();
+        if (iter != m_indices.end() && *iter == pos) {
+            m_values[static_cast<size_t>(offset)] = std::move(value);
+        } else {
+            m_indices.insert(iter, pos);
+            m_values.insert(m_values.begin() + offset, std::move(value));
+        }
+    }
+
+    /// Removes all stored entries whose absolute value is not larger than tolerance.
+    void prune(BaseT tolerance = BaseT{})
+    {
+        size_t target = 0;
+        for (size_t entry = 0; entry < m_indices.size(); ++entry) {
+            using std::abs;
+            if (abs(m_values[entry]) > tolerance) {
+                m_indices[target] = m_indices[entry];
+                m_values[target] = std::move(m_values[entry]);
+                ++target;
+            }
+        }
+        m_indices.resize(target);
+        m_values.resize(target);
+    }
+};
+
+namespace detail
+{
+template<typename T, typename = void>
+struct has_data : std::false_type
+{
+};
+
+template<typename T>
+struct has_data<T, std::void_t<decltype(std::declval<T &>().data())>> : std::true_type
+{
+};
+
+/// Calls operation(dense) with a raw pointer if the container is contiguous (has data()) and
+/// with the container itself otherwise, so loops over contiguous storage can be vectorized.
+template<typename Container, typename Operation>
+decltype(auto) with_dense_access(Container &container, Operation operation)
+{
+    if constexpr (has_data<Container>::value) {
+        return operation(container.data());
+    } else {
+        return operation(container);
+    }
+}
+
+/// Merges the patterns of lhs and rhs, calling op(lhsValue, rhsValue) with zero for a missing
+/// entry. Indices are advanced without branching on which side is smaller.
+template<typename BaseT, typename AllocT, typename BinaryOp>
+SparseVector<BaseT, AllocT> merge_sorted(SparseVector<BaseT, AllocT> const &lhs,
+                                         SparseVector<BaseT, AllocT> const &rhs,
+                                         BinaryOp op)
+{
+    assert(lhs.size() == rhs.size());
+    auto const &lhsIndices = lhs.indices();
+    auto const &rhsIndices = rhs.indices();
+    auto const &lhsValues = lhs.values();
+    auto const &rhsValues = rhs.values();
+    auto const lhsCount = lhsIndices.size();
+    auto const rhsCount = rhsIndices.size();
+    BaseT const zero{};
+
+    SparseVector<BaseT, AllocT> result(lhs.size(), lhs.get_allocator());
+    result.reserve(lhsCount + rhsCount);
+
+    size_t lhsEntry = 0;
+    size_t rhsEntry = 0;
+    while (lhsEntry < lhsCount && rhsEntry < rhsCount) {
+        auto const lhsIndex = lhsIndices[lhsEntry];
+        auto const rhsIndex = rhsIndices[rhsEntry];
+        bool const takeLhs = lhsIndex <= rhsIndex;
+        bool const takeRhs = rhsIndex <= lhsIndex;
+        result.push_back(takeLhs ? lhsIndex : rhsIndex,
+                         op(takeLhs ? lhsValues[lhsEntry] : zero,
+                            takeRhs ? rhsValues[rhsEntry] : zero));
+        lhsEntry += takeLhs;
+        rhsEntry += takeRhs;
+    }
+    for (; lhsEntry < lhsCount; ++lhsEntry) {
+        result.push_back(lhsIndices[lhsEntry], op(lhsValues[lhsEntry], zero));
+    }
+    for (; rhsEntry < rhsCount; ++rhsEntry) {
+        result.push_back(rhsIndices[rhsEntry], op(zero, rhsValues[rhsEntry]));
+    }
+    return result;
+}
+} // namespace detail
+
+/// Builds a sparse vector from all entries of dense whose absolute value exceeds tolerance.
+template<typename Container, typename BaseT = typename Container::value_type>
+auto sparse_from_dense(Container const &dense, BaseT tolerance = BaseT{})
+{
+    SparseVector<BaseT> result(static_cast<ptrdiff_t>(dense.size()));
+    for (ptrdiff_t pos = 0; pos < static_cast<ptrdiff_t>(dense.size()); ++pos) {
+        using std::abs;
+        if (abs(dense[pos]) > tolerance) {
+            result.push_back(pos, dense[pos]);
+        }
+    }
+    return result;
+}
+
+/// dense[i] = sparse[i] for the stored entries of sparse only.
+template<typename BaseT, typename AllocT, typename Container>
+void scatter(SparseVector<BaseT, AllocT> const &sparse, Container &&dense)
+{
+    auto const &indices = sparse.indices();
+    auto const &values = sparse.values();
+    detail::with_dense_access(dense, [&](auto &&target) {
+        for (size_t entry = 0; entry < indices.size(); ++entry) {
+            target[indices[entry]] = values[entry];
+        }
+    });
+}
+
+/// Writes sparse into dense (a view or slice of equal size), all other entries are set to zero.
+template<typename BaseT, typename AllocT, typename Container>
+void to_dense(SparseVector<BaseT, AllocT> const &sparse, Container &&dense)
+{
+    assert(static_cast<ptrdiff_t>(dense.size()) == sparse.size());
+    for (ptrdiff_t pos = 0; pos < static_cast<ptrdiff_t>(dense.size()); ++pos) {
+        dense[pos] = BaseT{};
+    }
+    scatter(sparse, dense);
+}
+
+/// Dot product with a dense vector, touching only the stored entries of sparse.
+template<typename BaseT, typename AllocT, typename Container>
+BaseT dot(SparseVector<BaseT, AllocT> const &sparse, Container const &dense)
+{
+    assert(static_cast<ptrdiff_t>(dense.size()) == sparse.size());
+    auto const &indices = sparse.indices();
+    auto const &values = sparse.values();
+    return detail::with_dense_access(dense, [&](auto &&source) {
+        BaseT result{};
+        for (size_t entry = 0; entry < indices.size(); ++entry) {
+            result += values[entry] * source[indices[entry]];
+        }
+        return result;
+    });
+}
+
+/// Dot product of two sparse vectors by a branch-free merge of their patterns.
+template<typename BaseT, typename AllocT>
+BaseT dot(SparseVector<BaseT, AllocT> const &lhs, SparseVector<BaseT, AllocT> const &rhs)
+{
+    assert(lhs.size() == rhs.size());
+    auto const &lhsIndices = lhs.indices();
+    auto const &rhsIndices = rhs.indices();
+    auto const &lhsValues = lhs.values();
+    auto const &rhsValues = rhs.values();
+
+    BaseT result{};
+    size_t lhsEntry = 0;
+    size_t rhsEntry = 0;
+    while (lhsEntry < lhsIndices.size() && rhsEntry < rhsIndices.size()) {
+        auto const lhsIndex = lhsIndices[lhsEntry];
+        auto const rhsIndex = rhsIndices[rhsEntry];
+        if (lhsIndex == rhsIndex) {
+            result += lhsValues[lhsEntry] * rhsValues[rhsEntry];
+        }
+        lhsEntry += lhsIndex <= rhsIndex;
+        rhsEntry += rhsIndex <= lhsIndex;
+    }
+    return result;
+}
+
+/// dense += alpha * sparse, touching only the stored entries of sparse.
+template<typename ScalarT, typename BaseT, typename AllocT, typename Container>
+void axpy(ScalarT alpha, SparseVector<BaseT, AllocT> const &sparse, Container &&dense)
+{
+    assert(static_cast<ptrdiff_t>(dense.size()) == sparse.size());
+    auto const &indices = sparse.indices();
+    auto const &values = sparse.values();
+    detail::with_dense_access(dense, [&](auto &&target) {
+        for (size_t entry = 0; entry < indices.size(); ++entry) {
+            target[indices[entry]] += alpha * values[entry];
+        }
+    });
+}
+
+/// target = alpha * sparse + target, the pattern of target becomes the union of both patterns.
+template<typename ScalarT, typename BaseT, typename AllocT>
+void axpy(ScalarT alpha,
+          SparseVector<BaseT, AllocT> const &sparse,
+          SparseVector<BaseT, AllocT> &target)
+{
+    target = detail::merge_sorted(sparse, target, [alpha](BaseT const &x, BaseT const &y) {
+        return alpha * x + y;
+    });
+}
+
+/// Element-wise op over the union of both patterns, missing entries are passed as zero.
+template<typename BaseT, typename AllocT, typename BinaryOp = std::plus<>>
+SparseVector<BaseT, AllocT> merge(SparseVector<BaseT, AllocT> const &lhs,
+                                  SparseVector<BaseT, AllocT> const &rhs,
+                                  BinaryOp op = BinaryOp{})
+{
+    return detail::merge_sorted(lhs, rhs, op);
+}
+
+namespace pmr
+{
+template<typename BaseT>
+using SparseVector = cpputility::SparseVector<BaseT, std::pmr::polymorphic_allocator<BaseT>>;
+} // namespace pmr
+} // namespace cpputility
+#endif // CPPUTILITY_CONTAINERS_SPARSE_VECTOR_HPP
@@ -0,0 +1,125 @@
+/* NetSim Project - Numerical Simulation, Analysis and Optimization of District Heating Networks
+ *
+ * include/cpputility/containers/static_vector.hpp
+ *
+ * created: 2026-10-19, Dominik Linn <d.linn@gmx.net> <dominik.linn@itwm.fraunhofer.de>
+ *
+ * (c) 2026 Dominik Linn, Fraunhofer ITWM
+ *
+ */
+
+#ifndef CPPUTILITY_CONTAINERS_STATIC_VECTOR_HPP
+#define CPPUTILITY_CONTAINERS_STATIC_VECTOR_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <utility>
+
+#include <cpputility/containers/iterator.hpp>
+#include <cpputility/containers/vector_base.hpp>
+
+namespace cpputility
+{
+/// Vector with fixed capacity and inline storage, it never allocates. For literal element types
+/// it can be built, modified and iterated (also through slices) in constant expressions.
+template<typename BaseT, size_t Capacity>
+class StaticVector : public VectorBase<StaticVector<BaseT, Capacity>, BaseT>
+{
+    static_assert(Capacity > 0, "StaticVector requires a non-zero capacity");
+
+public:
+    using value_type = BaseT;
+
+private:
+    BaseT m_data[Capacity]{};
+    size_t m_size = 0;
+
+public:
+    constexpr StaticVector() = default;
+
+    constexpr StaticVector(std::initializer_list<BaseT> values)
+    {
+        assert(values.size() <= Capacity);
+        for (auto const &value : values) {
+            m_data[m_size++] = value;
+        }
+    }
+
+    constexpr explicit StaticVector(size_t size, BaseT const &value = BaseT{})
+    {
+        resize(size, value);
+    }
+
+    constexpr value_type &get(ptrdiff_t pos)
+    {
+        assert(static_cast<size_t>(pos) < m_size);
+        return m_data[pos];
+    }
+
+    constexpr value_type const &get(ptrdiff_t pos) const
+    {
+        assert(static_cast<size_t>(pos) < m_size);
+        return m_data[pos];
+    }
+
+    constexpr value_type &get_front() { return get(0); }
+
+    constexpr value_type const &get_front() const { return get(0); }
+
+    constexpr value_type &get_back() { return get(get_size() - 1); }
+
+    constexpr value_type const &get_back() const { return get(get_size() - 1); }
+
+    constexpr ptrdiff_t get_size() const { return static_cast<ptrdiff_t>(m_size); }
+
+    static constexpr size_t capacity() { return Capacity; }
+
+    constexpr bool full() const { return m_size == Capacity; }
+
+    constexpr BaseT *data() { return m_data; }
+
+    constexpr BaseT const *data() const { return m_data; }
+
+    constexpr void clear() { m_size = 0; }
+
+    constexpr void push_back(BaseT const &value)
+    {
+        assert(m_size < Capacity);
+        m_data[m_size++] = value;
+    }
+
+    constexpr void push_back(BaseT &&value)
+    {
+        assert(m_size < Capacity);
+        m_data[m_size++] = std::move(value);
+    }
+
+    template<typename... Args>
+    constexpr BaseT &emplace_back(Args &&... args)
+    {
+        assert(m_size < Capacity);
+        m_data[m_size] = BaseT(std::forward<Args>(args)...);
+        return m_data[m_size++];
+    }
+
+    constexpr void pop_back()
+    {
+        assert(m_size > 0);
+        m_data[--m_size] = BaseT{};
+    }
+
+    constexpr void resize(size_t size, BaseT const &value = BaseT{})
+    {
+        assert(size <= Capacity);
+        for (; m_size < size; ++m_size) {
+            m_data[m_size] = value;
+        }
+        for (; m_size > size; --m_size) {
+            m_data[m_size - 1] = BaseT{};
+        }
+    }
+};
+
+} // namespace cpputility
+#endif // CPPUTILITY_CONTAINERS_STATIC_VECTOR_HPP
@@ -12,30 +12,37 @@
 #define CPPUTILITY_STORAGE_VECTOR_HPP
 
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 #include <cpputility/containers/iterator.hpp>
 #include <cpputility/containers/vector_base.hpp>
+#include <cpputility/memory.hpp>
+#include <cpputility/trace.hpp>
 
 namespace cpputility
 {
-template<typename BaseT, typename DelT = std::default_delete<BaseT>>
-class StorageVector : public VectorBase<StorageVector<BaseT, DelT>, BaseT>
+template<typename BaseT,
+         typename DelT = std::default_delete<BaseT>,
+         typename AllocT = std::allocator<std::unique_ptr<BaseT, DelT>>>
+class StorageVector : public VectorBase<StorageVector<BaseT, DelT, AllocT>, BaseT>
 {
 public:
-    using const_iterator = ConstIterator<BaseT, StorageVector<BaseT, DelT>>;
-    using iterator = Iterator<BaseT, StorageVector<BaseT, DelT>>;
+    using base_type = VectorBase<StorageVector<BaseT, DelT, AllocT>, BaseT>;
+    using const_iterator = typename base_type::const_iterator;
+    using iterator = typename base_type::iterator;
     using value_type = BaseT;
+    using allocator_type = AllocT;
+    using pointer_vector = std::vector<std::unique_ptr<BaseT, DelT>, AllocT>;
 
 private:
-    std::vector<std::unique_ptr<BaseT, DelT>> m_objects;
+    pointer_vector m_objects;
 
 public:
     StorageVector() = default;
+    explicit StorageVector(AllocT const &allocator) : m_objects(allocator) {}
     StorageVector(StorageVector &&other) : m_objects{std::move(other.m_objects)} {}
-    StorageVector(std::vector<std::unique_ptr<BaseT, DelT>> &&other) : m_objects{std::move(other)}
-    {
-    }
+    StorageVector(pointer_vector &&other) : m_objects{std::move(other)} {}
     StorageVector(StorageVector const &rhs) = delete;
 
     StorageVector &operator=(StorageVector &&rhs)
@@ -48,16 +55,31 @@ public:
 
     virtual ~StorageVector() = default;
 
+    /// Deep copy using the same allocator, objects of a pmr::StorageVector are copied into the
+    /// memory resource of their original.
+    ///
+    /// Every element is copy constructed as a BaseT, so elements of a derived type (e.g. stored
+    /// through the conversion of pmr_unique_ptr<Derived>) are sliced. Copy polymorphic elements
+    /// element-wise through a virtual clone function of BaseT instead.
     StorageVector clone() const
     {
-        StorageVector result;
-        for (BaseT const &elem : *this) {
-            result.emplace_back(std::make_unique<BaseT>(elem));
+        CPPUTILITY_TRACE_SCOPE("cpputility::StorageVector::clone");
+        StorageVector result(get_allocator());
+        result.m_objects.reserve(m_objects.size());
+        for (auto const &object : m_objects) {
+            if constexpr (std::is_same_v<DelT, PolymorphicDeleter<BaseT>>) {
+                auto *resource = object.get_deleter().resource();
+                result.emplace_back(make_unique_pmr<BaseT>(resource, *object));
+            } else {
+                result.emplace_back(std::make_unique<BaseT>(*object));
+            }
         }
 
         return result;
     }
 
+    inline allocator_type get_allocator() const { return m_objects.get_allocator(); }
+
     BaseT &get(size_t pos) const
     {
         assert(pos < this->size());
@@ -78,6 +100,11 @@ public:
 
     inline size_t get_size() const { return m_objects.size(); }
 
+    /// Owning pointers of the elements, reordering them reorders the vector without moving objects.
+    pointer_vector &get_pointers() { return m_objects; }
+
+    pointer_vector const &get_pointers() const { return m_objects; }
+
     void clear() { m_objects.clear(); }
 
     void emplace_back(std::unique_ptr<BaseT, DelT> &&value)
@@ -85,10 +112,17 @@ public:
         m_objects.emplace_back(std::move(value));
     }
 
-    void emplace(iterator &position, std::unique_ptr<BaseT, DelT> &&value)
+    void emplace(iterator position, std::unique_ptr<BaseT, DelT> &&value)
     {
-        auto pos = position - this->begin();
-        m_objects.emplace(pos, move(value));
+        auto const pos = position - this->begin();
+        m_objects.emplace(m_objects.begin() + pos, std::move(value));
+    }
+
+    /// Removes and destroys the element at position.
+    void erase(iterator position)
+    {
+        auto const pos = position - this->begin();
+        m_objects.erase(m_objects.begin() + pos);
     }
 
     //        template <typename ...Args>
@@ -97,6 +131,17 @@ public:
     //            m_objects.emplace_back(std::make_unique<BaseT>(args...));
     //        }
 };
+
+namespace pmr
+{
+/// StorageVector allocating its pointer array and, through make_unique_pmr, its objects from a
+/// std::pmr::memory_resource.
+template<typename BaseT>
+using StorageVector
+    = cpputility::StorageVector<BaseT,
+                                PolymorphicDeleter<BaseT>,
+                                std::pmr::polymorphic_allocator<pmr_unique_ptr<BaseT>>>;
+} // namespace pmr
 } // namespace cpputility
 
 #endif // CPPUTILITY_STORAGE_VECTOR_HPP
@@ -15,57 +15,57 @@ public:
     using iterator = Iterator<value_type, VectorBase<Derived, ValueT>>;
 
 public:
-    value_type &operator[](ptrdiff_t pos)
+    constexpr value_type &operator[](ptrdiff_t pos)
     {
         Derived &derivedObject = static_cast<Derived &>(*this);
         return derivedObject.get(pos);
     }
 
-    value_type const &operator[](ptrdiff_t pos) const
+    constexpr value_type const &operator[](ptrdiff_t pos) const
     {
         Derived const &derivedObject = static_cast<Derived const &>(*this);
         return derivedObject.get(pos);
     }
 
-    value_type &front()
+    constexpr value_type &front()
     {
         Derived &derivedObject = static_cast<Derived &>(*this);
         return derivedObject.get_front();
     }
 
-    value_type const &front() const
+    constexpr value_type const &front() const
     {
         Derived const &derivedObject = static_cast<Derived const &>(*this);
         return derivedObject.get_front();
     }
 
-    value_type &back()
+    constexpr value_type &back()
     {
         Derived &derivedObject = static_cast<Derived &>(*this);
         return derivedObject.get_back();
     }
 
-    value_type const &back() const
+    constexpr value_type const &back() const
     {
         Derived const &derivedObject = static_cast<Derived const &>(*this);
         return derivedObject.get_back();
     }
 
-    inline ptrdiff_t size() const
+    constexpr ptrdiff_t size() const
     {
         Derived const &derivedObject = static_cast<Derived const &>(*this);
         return derivedObject.get_size();
     }
 
-    inline bool empty() const { return size() == 0; }
+    constexpr bool empty() const { return size() == 0; }
 
-    auto begin() { return iterator(*this); }
-    auto begin() const { return const_iterator(*this); }
-    auto cbegin() const { return const_iterator(*this); }
+    constexpr auto begin() { return iterator(*this); }
+    constexpr auto begin() const { return const_iterator(*this); }
+    constexpr auto cbegin() const { return const_iterator(*this); }
 
-    auto end() { return iterator(*this, size()); }
-    auto end() const { return const_iterator(*this, size()); }
-    auto cend() const { return const_iterator(*this, size()); }
+    constexpr auto end() { return iterator(*this, size()); }
+    constexpr auto end() const { return const_iterator(*this, size()); }
+    constexpr auto cend() const { return const_iterator(*this, size()); }
 };
 
 template<typename Derived, typename ValueT>
@@ -77,37 +77,37 @@ public:
     using iterator = Iterator<value_type, ConstVectorBase<Derived, ValueT>>;
 
 public:
-    value_type const &operator[](ptrdiff_t pos) const
+    constexpr value_type const &operator[](ptrdiff_t pos) const
     {
         auto const &derivedObject = static_cast<Derived const &>(*this);
         return derivedObject.get(pos);
     }
 
-    value_type const &front() const
+    constexpr value_type const &front() const
     {
         Derived const &derivedObject = static_cast<Derived const &>(*this);
         return derivedObject.get_front();
     }
 
-    value_type const &back() const
+    constexpr value_type const &back() const
     {
         Derived const &derivedObject = static_cast<Derived const &>(*this);
         return derivedObject.get_back();
     }
 
-    inline ptrdiff_t size() const
+    constexpr ptrdiff_t size() const
     {
         auto const &derivedObject = static_cast<Derived const &>(*this);
         return derivedObject.get_size();
     }
 
-    inline bool empty() const { return size() == 0; }
+    constexpr bool empty() const { return size() == 0; }
 
-    auto begin() const { return const_iterator(*this); }
-    auto cbegin() const { return const_iterator(*this); }
+    constexpr auto begin() const { return const_iterator(*this); }
+    constexpr auto cbegin() const { return const_iterator(*this); }
 
-    auto end() const { return const_iterator(*this, size()); }
-    auto cend() const { return const_iterator(*this, size()); }
+    constexpr auto end() const { return const_iterator(*this, size()); }
+    constexpr auto cend() const { return const_iterator(*this, size()); }
 };
 } // namespace cpputility
 
@@ -0,0 +1,371 @@
+/* NetSim Project - Numerical Simulation, Analysis and Optimization of District Heating Networks
+ *
+ * include/cpputility/containers/vector_expression.hpp
+ *
+ * created: 2026-10-19, Dominik Linn <d.linn@gmx.net> <dominik.linn@itwm.fraunhofer.de>
+ *
+ * (c) 2026 Dominik Linn, Fraunhofer ITWM
+ *
+ */
+
+#ifndef CPPUTILITY_CONTAINERS_VECTOR_EXPRESSION_HPP
+#define CPPUTILITY_CONTAINERS_VECTOR_EXPRESSION_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cpputility/parallel.hpp>
+#include <cpputility/trace.hpp>
+
+namespace cpputility
+{
+template<class VectorT>
+class VectorView;
+template<class VectorT>
+class ConstVectorView;
+template<typename VectorT>
+class VectorSlice;
+template<typename VectorT>
+class ConstVectorSlice;
+
+/// Minimal size from which assign() evaluates an expression on several threads.
+constexpr size_t default_parallel_expression_size = size_t{1} << 16;
+
+template<typename Op, class Lhs, class Rhs>
+class BinaryExpression;
+template<typename Op, class Operand>
+class UnaryExpression;
+
+namespace detail
+{
+template<class T>
+struct is_vector_operand : std::false_type
+{
+};
+
+template<class VectorT>
+struct is_vector_operand<VectorView<VectorT>> : std::true_type
+{
+};
+
+template<class VectorT>
+struct is_vector_operand<ConstVectorView<VectorT>> : std::true_type
+{
+};
+
+template<class VectorT>
+struct is_vector_operand<VectorSlice<VectorT>> : std::true_type
+{
+};
+
+template<class VectorT>
+struct is_vector_operand<ConstVectorSlice<VectorT>> : std::true_type
+{
+};
+
+template<class T>
+struct is_vector_expression : std::false_type
+{
+};
+
+template<typename Op, class Lhs, class Rhs>
+struct is_vector_expression<BinaryExpression<Op, Lhs, Rhs>> : std::true_type
+{
+};
+
+template<typename Op, class Operand>
+struct is_vector_expression<UnaryExpression<Op, Operand>> : std::true_type
+{
+};
+
+template<class T>
+constexpr bool is_vector_expression_v = is_vector_expression<std::decay_t<T>>::value;
+
+template<class T>
+constexpr bool is_expression_operand_v = is_vector_operand<std::decay_t<T>>::value
+                                         || is_vector_expression<std::decay_t<T>>::value;
+
+template<class T>
+constexpr bool is_expression_scalar_v = std::is_arithmetic<std::decay_t<T>>::value;
+
+template<class Lhs, class Rhs>
+constexpr bool is_binary_expression_v
+    = (is_expression_operand_v<Lhs>
+       && (is_expression_operand_v<Rhs> || is_expression_scalar_v<Rhs>))
+      || (is_expression_scalar_v<Lhs> && is_expression_operand_v<Rhs>);
+
+/// A scalar broadcast to every position of an expression.
+template<typename T>
+class ScalarOperand
+{
+private:
+    T m_value;
+
+public:
+    constexpr explicit ScalarOperand(T value) : m_value{value} {}
+
+    constexpr T operator[](ptrdiff_t) const { return m_value; }
+};
+
+/// Views and slices are stored by value in an expression (they are just a pointer and a range),
+/// scalars are wrapped into a ScalarOperand.
+template<class T>
+constexpr auto wrap_operand(T const &operand)
+{
+    if constexpr (is_expression_scalar_v<T>) {
+        return ScalarOperand<T>(operand);
+    } else {
+        return operand;
+    }
+}
+
+/// Size of an operand, -1 for scalars.
+template<class T>
+constexpr ptrdiff_t operand_size(T const &operand)
+{
+    if constexpr (is_expression_scalar_v<T>) {
+        return -1;
+    } else {
+        return static_cast<ptrdiff_t>(operand.size());
+    }
+}
+
+template<class T>
+constexpr ptrdiff_t operand_size(ScalarOperand<T> const &)
+{
+    return -1;
+}
+
+template<typename Op, class Lhs, class Rhs>
+constexpr auto make_binary_expression(Lhs const &lhs, Rhs const &rhs)
+{
+    using LhsOperand = decltype(wrap_operand(lhs));
+    using RhsOperand = decltype(wrap_operand(rhs));
+    return BinaryExpression<Op, LhsOperand, RhsOperand>(wrap_operand(lhs), wrap_operand(rhs));
+}
+} // namespace detail
+
+/// Lazily evaluated op(lhs[pos], rhs[pos]); built by the arithmetic operators below and evaluated
+/// only when assigned to a view or slice.
+template<typename Op, class Lhs, class Rhs>
+class BinaryExpression
+{
+private:
+    Lhs m_lhs;
+    Rhs m_rhs;
+    ptrdiff_t m_size;
+
+public:
+    using value_type = std::decay_t<decltype(
+        Op{}(std::declval<Lhs const &>()[0], std::declval<Rhs const &>()[0]))>;
+
+    constexpr BinaryExpression(Lhs lhs, Rhs rhs) : m_lhs{std::move(lhs)}, m_rhs{std::move(rhs)}
+    {
+        auto const lhsSize = detail::operand_size(m_lhs);
+        auto const rhsSize = detail::operand_size(m_rhs);
+        assert(lhsSize < 0 || rhsSize < 0 || lhsSize == rhsSize);
+        m_size = lhsSize >= 0 ? lhsSize : rhsSize;
+    }
+
+    constexpr ptrdiff_t size() const { return m_size; }
+
+    constexpr Lhs const &lhs() const { return m_lhs; }
+
+    constexpr Rhs const &rhs() const { return m_rhs; }
+
+    constexpr value_type operator[](ptrdiff_t pos) const { return Op{}(m_lhs[pos], m_rhs[pos]); }
+};
+
+/// Lazily evaluated op(operand[pos]).
+template<typename Op, class Operand>
+class UnaryExpression
+{
+private:
+    Operand m_operand;
+    Op m_op;
+
+public:
+    using value_type = std::decay_t<decltype(
+        std::declval<Op const &>()(std::declval<Operand const &>()[0]))>;
+
+    constexpr UnaryExpression(Operand operand, Op op)
+        : m_operand{std::move(operand)}, m_op{std::move(op)}
+    {
+    }
+
+    constexpr ptrdiff_t size() const { return detail::operand_size(m_operand); }
+
+    constexpr Operand const &operand() const { return m_operand; }
+
+    constexpr value_type operator[](ptrdiff_t pos) const { return m_op(m_operand[pos]); }
+};
+
+template<class Lhs,
+         class Rhs,
+         typename = std::enable_if_t<detail::is_binary_expression_v<Lhs, Rhs>>>
+constexpr auto operator+(Lhs const &lhs, Rhs const &rhs)
+{
+    return detail::make_binary_expression<std::plus<>>(lhs, rhs);
+}
+
+template<class Lhs,
+         class Rhs,
+         typename = std::enable_if_t<detail::is_binary_expression_v<Lhs, Rhs>>>
+constexpr auto operator-(Lhs const &lhs, Rhs const &rhs)
+{
+    return detail::make_binary_expression<std::minus<>>(lhs, rhs);
+}
+
+template<class Lhs,
+         class Rhs,
+         typename = std::enable_if_t<detail::is_binary_expression_v<Lhs, Rhs>>>
+constexpr auto operator*(Lhs const &lhs, Rhs const &rhs)
+{
+    return detail::make_binary_expression<std::multiplies<>>(lhs, rhs);
+}
+
+template<class Lhs,
+         class Rhs,
+         typename = std::enable_if_t<detail::is_binary_expression_v<Lhs, Rhs>>>
+constexpr auto operator/(Lhs const &lhs, Rhs const &rhs)
+{
+    return detail::make_binary_expression<std::divides<>>(lhs, rhs);
+}
+
+template<class Operand, typename = std::enable_if_t<detail::is_expression_operand_v<Operand>>>
+constexpr auto operator-(Operand const &operand)
+{
+    return UnaryExpression<std::negate<>, Operand>(operand, std::negate<>{});
+}
+
+/// Lazily applies the element-wise function op, e.g. a lambda calling std::abs, to operand.
+template<class Operand,
+         typename Op,
+         typename = std::enable_if_t<detail::is_expression_operand_v<Operand>>>
+constexpr auto map_expression(Operand const &operand, Op op)
+{
+    return UnaryExpression<Op, Operand>(operand, std::move(op));
+}
+
+namespace detail
+{
+template<class T, typename Op>
+void for_each_leaf(T const &operand, Op &op);
+template<class T, typename Op>
+void for_each_leaf(ScalarOperand<T> const &, Op &);
+template<typename ExpressionOp, class Lhs, class Rhs, typename Op>
+void for_each_leaf(BinaryExpression<ExpressionOp, Lhs, Rhs> const &expression, Op &op);
+template<typename ExpressionOp, class Operand, typename Op>
+void for_each_leaf(UnaryExpression<ExpressionOp, Operand> const &expression, Op &op);
+
+/// Calls op for every view and slice read by an expression.
+template<class T, typename Op>
+void for_each_leaf(T const &operand, Op &op)
+{
+    op(operand);
+}
+
+template<class T, typename Op>
+void for_each_leaf(ScalarOperand<T> const &, Op &)
+{
+}
+
+template<typename ExpressionOp, class Lhs, class Rhs, typename Op>
+void for_each_leaf(BinaryExpression<ExpressionOp, Lhs, Rhs> const &expression, Op &op)
+{
+    for_each_leaf(expression.lhs(), op);
+    for_each_leaf(expression.rhs(), op);
+}
+
+template<typename ExpressionOp, class Operand, typename Op>
+void for_each_leaf(UnaryExpression<ExpressionOp, Operand> const &expression, Op &op)
+{
+    for_each_leaf(expression.operand(), op);
+}
+
+/// True if an operand reads an element of target at another position than the one it is assigned
+/// to, e.g. a shifted or strided slice of the vector target views. Meant for assertions only.
+template<class TargetT, class OperandT>
+bool reads_target_elsewhere(TargetT const &target, OperandT const &operand)
+{
+    auto const size = static_cast<ptrdiff_t>(target.size());
+    std::vector<std::pair<void const *, ptrdiff_t>> targetElements;
+    bool elsewhere = false;
+    auto const check = [&](auto const &leaf) {
+        bool samePositions = true;
+        for (ptrdiff_t pos = 0; pos < size && samePositions; ++pos) {
+            samePositions = static_cast<void const *>(std::addressof(leaf[pos]))
+                            == static_cast<void const *>(std::addressof(target[pos]));
+        }
+        if (samePositions) {
+            return;
+        }
+        if (targetElements.empty()) {
+            for (ptrdiff_t pos = 0; pos < size; ++pos) {
+                targetElements.emplace_back(std::addressof(target[pos]), pos);
+            }
+            std::sort(targetElements.begin(),
+                      targetElements.end(),
+                      [](auto const &lhs, auto const &rhs) {
+                          return std::less<void const *>{}(lhs.first, rhs.first);
+                      });
+        }
+        for (ptrdiff_t pos = 0; pos < size && !elsewhere; ++pos) {
+            void const *address = std::addressof(leaf[pos]);
+            auto const found = std::lower_bound(targetElements.begin(),
+                                                targetElements.end(),
+                                                address,
+                                                [](auto const &element, void const *value) {
+                                                    return std::less<void const *>{}(
+                                                        element.first, value);
+                                                });
+            elsewhere = found != targetElements.end() && found->first == address
+                        && found->second != pos;
+        }
+    };
+    for_each_leaf(operand, check);
+    return elsewhere;
+}
+} // namespace detail
+
+/// target[pos] = expression[pos] for all positions in one fused pass without temporaries; from
+/// default_parallel_expression_size elements on, blocks of target are evaluated concurrently.
+/// expression may refer to target itself at the same positions (x = x + dt * f), but not at
+/// different ones; debug builds assert this.
+template<class TargetT, class ExpressionT>
+void assign(TargetT &&target,
+            ExpressionT const &expression,
+            size_t thread_count = hardware_thread_count())
+{
+    CPPUTILITY_TRACE_SCOPE("cpputility::assign");
+    auto const operand = detail::wrap_operand(expression);
+    auto const size = static_cast<size_t>(target.size());
+    assert(detail::operand_size(operand) < 0
+           || detail::operand_size(operand) == static_cast<ptrdiff_t>(size));
+    assert(!detail::reads_target_elsewhere(std::as_const(target), operand));
+
+    auto const evaluate = [&target, &operand](size_t begin, size_t end) {
+        for (auto pos = static_cast<ptrdiff_t>(begin); pos < static_cast<ptrdiff_t>(end); ++pos) {
+            target[pos] = operand[pos];
+        }
+    };
+
+    if (size < default_parallel_expression_size || thread_count <= 1) {
+        evaluate(0, size);
+        return;
+    }
+    parallel_for_blocks(
+        size,
+        [&evaluate](size_t begin, size_t end, size_t) { evaluate(begin, end); },
+        default_parallel_expression_size / 2,
+        thread_count);
+}
+} // namespace cpputility
+
+#endif // CPPUTILITY_CONTAINERS_VECTOR_EXPRESSION_HPP
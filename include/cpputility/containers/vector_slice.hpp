@@ -13,9 +13,11 @@
 
 #include <cstddef>
 #include <memory>
+#include <type_traits>
 
 #include <cpputility/containers/iterator.hpp>
 #include <cpputility/containers/vector_base.hpp>
+#include <cpputility/containers/vector_expression.hpp>
 
 namespace cpputility
 {
@@ -33,7 +35,7 @@ public:
 
     VectorSlice() = delete;
 
-    VectorSlice(VectorT &array, ptrdiff_t start, ptrdiff_t end, ptrdiff_t stride = 1)
+    constexpr VectorSlice(VectorT &array, ptrdiff_t start, ptrdiff_t end, ptrdiff_t stride = 1)
         : m_base{&array}, m_start{start}, m_stride{stride}, m_end{end}
     {
         // REQUIRE(start, ErrorHandling::isLessOrEqualTo, end);
@@ -41,18 +43,18 @@ public:
         // REQUIRE(end, isLessThan, array.size());
     }
 
-    VectorSlice(const VectorSlice &other)
+    constexpr VectorSlice(const VectorSlice &other)
         : m_base{other.m_base}, m_start{other.m_start}, m_stride{other.m_stride}, m_end{other.m_end}
     {
     }
 
-    VectorSlice(VectorSlice &&other)
+    constexpr VectorSlice(VectorSlice &&other)
         : m_base{std::move(other.m_base)}, m_start{std::move(other.m_start)},
           m_stride{other.m_stride}, m_end{std::move(other.m_end)}
     {
     }
 
-    VectorSlice &operator=(const VectorSlice &other)
+    constexpr VectorSlice &operator=(const VectorSlice &other)
     {
         m_base = other.m_base;
         m_start = other.m_start;
@@ -61,7 +63,7 @@ public:
         return *this;
     }
 
-    VectorSlice &operator=(VectorSlice &&other)
+    constexpr VectorSlice &operator=(VectorSlice &&other)
     {
         if (this != &other) {
             m_base = std::move(other.m_base);
@@ -69,24 +71,63 @@ public:
         return *this;
     }
 
-    inline size_t get_size() const { return (m_end - m_start) / m_stride; }
+    /// Evaluates expression into the elements of the slice in a single pass, see assign().
+    template<class ExpressionT,
+             typename = std::enable_if_t<detail::is_vector_expression_v<ExpressionT>>>
+    VectorSlice &operator=(ExpressionT const &expression)
+    {
+        assign(*this, expression);
+        return *this;
+    }
 
-    inline value_type &get(ptrdiff_t pos) { return (*m_base)[m_start + m_stride * pos]; }
+    template<class OperandT,
+             typename = std::enable_if_t<detail::is_binary_expression_v<VectorSlice, OperandT>>>
+    VectorSlice &operator+=(OperandT const &operand)
+    {
+        assign(*this, *this + operand);
+        return *this;
+    }
 
-    inline value_type const &get(ptrdiff_t pos) const
+    template<class OperandT,
+             typename = std::enable_if_t<detail::is_binary_expression_v<VectorSlice, OperandT>>>
+    VectorSlice &operator-=(OperandT const &operand)
     {
-        return (*m_base)[m_start + m_stride * pos];
+        assign(*this, *this - operand);
+        return *this;
+    }
+
+    template<class OperandT,
+             typename = std::enable_if_t<detail::is_binary_expression_v<VectorSlice, OperandT>>>
+    VectorSlice &operator*=(OperandT const &operand)
+    {
+        assign(*this, *this * operand);
+        return *this;
     }
 
-    inline value_type &get_front() { return get(0); }
+    template<class OperandT,
+             typename = std::enable_if_t<detail::is_binary_expression_v<VectorSlice, OperandT>>>
+    VectorSlice &operator/=(OperandT const &operand)
+    {
+        assign(*this, *this / operand);
+        return *this;
+    }
 
-    inline value_type const &get_front() const { return get(0); }
+    constexpr size_t get_size() const { return (m_end - m_start) / m_stride; }
 
-    inline value_type &get_back() { return get(this->size()); }
+    constexpr value_type &get(ptrdiff_t pos) { return (*m_base)[m_start + m_stride * pos]; }
 
-    inline value_type const &get_back() const { return get(this->size()); }
+    constexpr value_type const &get(ptrdiff_t pos) const
+    {
+        return (*m_base)[m_start + m_stride * pos];
+    }
+
+    constexpr value_type &get_front() { return get(0); }
+
+    constexpr value_type const &get_front() const { return get(0); }
 
-    virtual ~VectorSlice() = default;
+    constexpr value_type &get_back() { return get(this->size() - 1); }
+
+    constexpr value_type const &get_back() const { return get(this->size() - 1); }
 };
 
 template<typename VectorT>
@@ -104,7 +145,10 @@ public:
 
     ConstVectorSlice() = delete;
 
-    ConstVectorSlice(VectorT &vec, ptrdiff_t start, ptrdiff_t end, ptrdiff_t stride = 1)
+    constexpr ConstVectorSlice(VectorT &vec,
+                               ptrdiff_t start,
+                               ptrdiff_t end,
+                               ptrdiff_t stride = 1)
         : m_base{&vec}, m_start{start}, m_stride{stride}, m_end{end}
     {
         // REQUIRE(start, ErrorHandling::isLessOrEqualTo, end);
@@ -112,18 +156,18 @@ public:
         // REQUIRE(end, isLessThan, array.size());
     }
 
-    ConstVectorSlice(const ConstVectorSlice &other)
+    constexpr ConstVectorSlice(const ConstVectorSlice &other)
         : m_base{other.m_base}, m_start{other.m_start}, m_stride{other.m_stride}, m_end{other.m_end}
     {
     }
 
-    ConstVectorSlice(ConstVectorSlice &&other)
+    constexpr ConstVectorSlice(ConstVectorSlice &&other)
         : m_base{std::move(other.m_base)}, m_start{std::move(other.m_start)},
           m_stride{other.m_stride}, m_end{std::move(other.m_end)}
     {
     }
 
-    ConstVectorSlice &operator=(const ConstVectorSlice &other)
+    constexpr ConstVectorSlice &operator=(const ConstVectorSlice &other)
     {
         m_base = other.m_base;
         m_start = other.m_start;
@@ -132,7 +176,7 @@ public:
         return *this;
     }
 
-    ConstVectorSlice &operator=(ConstVectorSlice &&other)
+    constexpr ConstVectorSlice &operator=(ConstVectorSlice &&other)
     {
         if (this != &other) {
             m_base = std::move(other.m_base);
@@ -140,22 +184,20 @@ public:
         return *this;
     }
 
-    inline size_t get_size() const { return (m_end - m_start) / m_stride; }
+    constexpr size_t get_size() const { return (m_end - m_start) / m_stride; }
 
-    inline value_type const &get(ptrdiff_t pos) const
+    constexpr value_type const &get(ptrdiff_t pos) const
     {
         return (*m_base)[m_start + m_stride * pos];
     }
 
-    inline value_type const &get_front() const { return get(0); }
-
-    inline value_type const &get_back() const { return get(this->size()); }
+    constexpr value_type const &get_front() const { return get(0); }
 
-    virtual ~ConstVectorSlice() = default;
+    constexpr value_type const &get_back() const { return get(this->size() - 1); }
 };
 
 template<typename VectorT>
-auto slice(VectorT &vec, ptrdiff_t start, ptrdiff_t end, ptrdiff_t stride)
+constexpr auto slice(VectorT &vec, ptrdiff_t start, ptrdiff_t end, ptrdiff_t stride)
 
 {
     using Slice = VectorSlice<VectorT>;
@@ -163,21 +205,21 @@ auto slice(VectorT &vec, ptrdiff_t start, ptrdiff_t end, ptrdiff_t stride)
 }
 
 template<typename VectorT>
-auto slice(VectorT const &vec, ptrdiff_t start, ptrdiff_t end, ptrdiff_t stride)
+constexpr auto slice(VectorT const &vec, ptrdiff_t start, ptrdiff_t end, ptrdiff_t stride)
 {
     using Slice = ConstVectorSlice<VectorT>;
     return Slice(const_cast<VectorT &>(vec), start, end, stride);
 }
 
 template<typename VectorT>
-auto const_slice(VectorT const &vec, ptrdiff_t start, ptrdiff_t end, ptrdiff_t stride)
+constexpr auto const_slice(VectorT const &vec, ptrdiff_t start, ptrdiff_t end, ptrdiff_t stride)
 {
     using Slice = ConstVectorSlice<VectorT>;
     return Slice(const_cast<VectorT &>(vec), start, end, stride);
 }
 
 template<typename VectorT>
-auto const_slice(VectorT &vec, ptrdiff_t start, ptrdiff_t end, ptrdiff_t stride)
+constexpr auto const_slice(VectorT &vec, ptrdiff_t start, ptrdiff_t end, ptrdiff_t stride)
 {
     using Slice = ConstVectorSlice<VectorT>;
     return Slice(vec, start, end, stride);
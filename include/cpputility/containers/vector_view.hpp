@@ -13,9 +13,11 @@
 
 #include <cstddef>
 #include <memory>
+#include <type_traits>
 
 #include <cpputility/containers/iterator.hpp>
 #include <cpputility/containers/vector_base.hpp>
+#include <cpputility/containers/vector_expression.hpp>
 
 namespace cpputility
 {
@@ -50,6 +52,47 @@ public:
         return *this;
     }
 
+    /// Evaluates expression into the viewed elements in a single pass, see assign().
+    template<class ExpressionT,
+             typename = std::enable_if_t<detail::is_vector_expression_v<ExpressionT>>>
+    VectorView &operator=(ExpressionT const &expression)
+    {
+        assign(*this, expression);
+        return *this;
+    }
+
+    template<class OperandT,
+             typename = std::enable_if_t<detail::is_binary_expression_v<VectorView, OperandT>>>
+    VectorView &operator+=(OperandT const &operand)
+    {
+        assign(*this, *this + operand);
+        return *this;
+    }
+
+    template<class OperandT,
+             typename = std::enable_if_t<detail::is_binary_expression_v<VectorView, OperandT>>>
+    VectorView &operator-=(OperandT const &operand)
+    {
+        assign(*this, *this - operand);
+        return *this;
+    }
+
+    template<class OperandT,
+             typename = std::enable_if_t<detail::is_binary_expression_v<VectorView, OperandT>>>
+    VectorView &operator*=(OperandT const &operand)
+    {
+        assign(*this, *this * operand);
+        return *this;
+    }
+
+    template<class OperandT,
+             typename = std::enable_if_t<detail::is_binary_expression_v<VectorView, OperandT>>>
+    VectorView &operator/=(OperandT const &operand)
+    {
+        assign(*this, *this / operand);
+        return *this;
+    }
+
     inline value_type &get(ptrdiff_t pos) { return (*m_base)[pos]; }
 
     inline value_type const &get(ptrdiff_t pos) const { return (*m_base)[pos]; }
@@ -0,0 +1,177 @@
+/* NetSim Project - Numerical Simulation, Analysis and Optimization of District Heating Networks
+ *
+ * include/cpputility/memory.hpp
+ *
+ * created: 2026-10-19, Dominik Linn <d.linn@gmx.net> <dominik.linn@itwm.fraunhofer.de>
+ *
+ * (c) 2026 Dominik Linn, Fraunhofer ITWM
+ *
+ */
+
+#ifndef CPPUTILITY_MEMORY_HPP
+#define CPPUTILITY_MEMORY_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace cpputility
+{
+using std::size_t;
+
+struct MemoryStatistics
+{
+    size_t bytes_in_use = 0;
+    size_t peak_bytes = 0;
+    size_t total_bytes = 0;
+    size_t allocations = 0;
+    size_t deallocations = 0;
+};
+
+/// Memory resource forwarding to an upstream resource and recording bytes in use, the high-water
+/// mark and the number of (de)allocations. Give every container (or subsystem) its own instance
+/// to find out where memory goes; the counters are atomic, so an instance can be shared between
+/// threads.
+class CountingMemoryResource : public std::pmr::memory_resource
+{
+private:
+    std::pmr::memory_resource *m_upstream;
+    std::atomic<size_t> m_bytesInUse{0};
+    std::atomic<size_t> m_peakBytes{0};
+    std::atomic<size_t> m_totalBytes{0};
+    std::atomic<size_t> m_allocations{0};
+    std::atomic<size_t> m_deallocations{0};
+
+public:
+    explicit CountingMemoryResource(
+        std::pmr::memory_resource *upstream = std::pmr::get_default_resource())
+        : m_upstream{upstream}
+    {
+    }
+
+    CountingMemoryResource(CountingMemoryResource const &) = delete;
+
+    CountingMemoryResource &operator=(CountingMemoryResource const &) = delete;
+
+    inline std::pmr::memory_resource *upstream() const { return m_upstream; }
+
+    MemoryStatistics statistics() const
+    {
+        MemoryStatistics result;
+        result.bytes_in_use = m_bytesInUse.load(std::memory_order_relaxed);
+        result.peak_bytes = m_peakBytes.load(std::memory_order_relaxed);
+        result.total_bytes = m_totalBytes.load(std::memory_order_relaxed);
+        result.allocations = m_allocations.load(std::memory_order_relaxed);
+        result.deallocations = m_deallocations.load(std::memory_order_relaxed);
+        return result;
+    }
+
+    /// Restarts the high-water mark at the current number of bytes in use.
+    void reset_peak()
+    {
+        m_peakBytes.store(m_bytesInUse.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+protected:
+    void *do_allocate(size_t bytes, size_t alignment) override
+    {
+        void *pointer = m_upstream->allocate(bytes, alignment);
+
+        auto const inUse = m_bytesInUse.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        auto peak = m_peakBytes.load(std::memory_order_relaxed);
+        while (peak < inUse
+               && !m_peakBytes.compare_exchange_weak(peak, inUse, std::memory_order_relaxed)) {
+        }
+        m_totalBytes.fetch_add(bytes, std::memory_order_relaxed);
+        m_allocations.fetch_add(1, std::memory_order_relaxed);
+
+        return pointer;
+    }
+
+    void do_deallocate(void *pointer, size_t bytes, size_t alignment) override
+    {
+        m_upstream->deallocate(pointer, bytes, alignment);
+        m_bytesInUse.fetch_sub(bytes, std::memory_order_relaxed);
+        m_deallocations.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool do_is_equal(std::pmr::memory_resource const &other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+/// Deleter for objects created by make_unique_pmr, returning their memory to the resource.
+///
+/// The deleter records size and alignment of the allocated object, so a pointer to a derived
+/// object converts to a pmr_unique_ptr of its base (e.g. to be stored in a pmr::StorageVector)
+/// and is still deallocated correctly; the base then needs a virtual destructor.
+template<typename BaseT>
+class PolymorphicDeleter
+{
+private:
+    template<typename OtherT>
+    friend class PolymorphicDeleter;
+
+    std::pmr::memory_resource *m_resource = std::pmr::get_default_resource();
+    size_t m_size = sizeof(BaseT);
+    size_t m_alignment = alignof(BaseT);
+
+public:
+    PolymorphicDeleter() = default;
+
+    explicit PolymorphicDeleter(std::pmr::memory_resource *resource,
+                                size_t size = sizeof(BaseT),
+                                size_t alignment = alignof(BaseT))
+        : m_resource{resource}, m_size{size}, m_alignment{alignment}
+    {
+    }
+
+    template<typename OtherT,
+             typename = std::enable_if_t<std::is_convertible_v<OtherT *, BaseT *>>>
+    PolymorphicDeleter(PolymorphicDeleter<OtherT> const &other)
+        : m_resource{other.m_resource}, m_size{other.m_size}, m_alignment{other.m_alignment}
+    {
+    }
+
+    inline std::pmr::memory_resource *resource() const { return m_resource; }
+
+    void operator()(BaseT *pointer) const
+    {
+        // the allocation starts at the most derived object, which for multiple inheritance is not
+        // necessarily where the base subobject is
+        void *memory = pointer;
+        if constexpr (std::is_polymorphic_v<BaseT>) {
+            memory = dynamic_cast<void *>(pointer);
+        }
+        pointer->~BaseT();
+        m_resource->deallocate(memory, m_size, m_alignment);
+    }
+};
+
+template<typename BaseT>
+using pmr_unique_ptr = std::unique_ptr<BaseT, PolymorphicDeleter<BaseT>>;
+
+/// Counterpart of std::make_unique allocating the object from resource.
+template<typename BaseT, typename... Args>
+pmr_unique_ptr<BaseT> make_unique_pmr(std::pmr::memory_resource *resource, Args &&... args)
+{
+    void *memory = resource->allocate(sizeof(BaseT), alignof(BaseT));
+    try {
+        auto *object = new (memory) BaseT(std::forward<Args>(args)...);
+        return pmr_unique_ptr<BaseT>(object,
+                                     PolymorphicDeleter<BaseT>(resource,
+                                                               sizeof(BaseT),
+                                                               alignof(BaseT)));
+    } catch (...) {
+        resource->deallocate(memory, sizeof(BaseT), alignof(BaseT));
+        throw;
+    }
+}
+} // namespace cpputility
+
+#endif // CPPUTILITY_MEMORY_HPP
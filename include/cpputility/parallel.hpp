@@ -0,0 +1,140 @@
+/* NetSim Project - Numerical Simulation, Analysis and Optimization of District Heating Networks
+ *
+ * include/cpputility/parallel.hpp
+ *
+ * created: 2026-10-19, Dominik Linn <d.linn@gmx.net> <dominik.linn@itwm.fraunhofer.de>
+ *
+ * (c) 2026 Dominik Linn, Fraunhofer ITWM
+ *
+ */
+
+#ifndef CPPUTILITY_PARALLEL_HPP
+#define CPPUTILITY_PARALLEL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#include <cpputility/trace.hpp>
+
+namespace cpputility
+{
+using std::size_t;
+
+/// Minimal number of elements a block has to contain before work is split across threads.
+constexpr size_t default_min_block_size = 4096;
+
+inline size_t hardware_thread_count()
+{
+    auto const count = std::thread::hardware_concurrency();
+    return count == 0 ? 1 : static_cast<size_t>(count);
+}
+
+/// Number of blocks [0, size) is split into, at most one per thread and per min_block_size
+/// elements.
+inline size_t block_count(size_t size, size_t min_block_size, size_t thread_count)
+{
+    auto const minBlockSize = std::max(min_block_size, size_t{1});
+    auto const blocks = (size + minBlockSize - 1) / minBlockSize;
+    return std::max(size_t{1}, std::min(blocks, std::max(thread_count, size_t{1})));
+}
+
+/// First index of block blockIndex if [0, size) is split into blocks equally sized blocks.
+inline size_t block_begin(size_t size, size_t blocks, size_t blockIndex)
+{
+    return (size / blocks) * blockIndex + std::min(blockIndex, size % blocks);
+}
+
+/// Runs all operations concurrently, the first one on the calling thread. The first exception
+/// thrown by any of the operations is rethrown after all of them finished.
+template<typename Operation>
+void parallel_invoke_n(size_t count, Operation operation)
+{
+    if (count == 0) {
+        return;
+    }
+    if (count == 1) {
+        operation(size_t{0});
+        return;
+    }
+
+    std::vector<std::exception_ptr> errors(count);
+    std::vector<std::thread> threads;
+    threads.reserve(count - 1);
+    for (size_t index = 1; index < count; ++index) {
+        threads.emplace_back([&operation, &errors, index]() {
+            try {
+                CPPUTILITY_TRACE_SCOPE("cpputility::parallel_invoke_n");
+                operation(index);
+            } catch (...) {
+                errors[index] = std::current_exception();
+            }
+        });
+    }
+
+    try {
+        CPPUTILITY_TRACE_SCOPE("cpputility::parallel_invoke_n");
+        operation(size_t{0});
+    } catch (...) {
+        errors[0] = std::current_exception();
+    }
+
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (auto &error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+template<typename OperationA, typename OperationB>
+void parallel_invoke(OperationA operationA, OperationB operationB)
+{
+    parallel_invoke_n(2, [&](size_t index) {
+        if (index == 0) {
+            operationA();
+        } else {
+            operationB();
+        }
+    });
+}
+
+/// Splits [0, size) into contiguous blocks and calls operation(begin, end, blockIndex) for every
+/// block, each block on its own thread.
+template<typename Operation>
+void parallel_for_blocks(size_t size,
+                         Operation operation,
+                         size_t min_block_size = default_min_block_size,
+                         size_t thread_count = hardware_thread_count())
+{
+    auto const blocks = block_count(size, min_block_size, thread_count);
+    parallel_invoke_n(blocks, [&](size_t blockIndex) {
+        operation(block_begin(size, blocks, blockIndex),
+                  block_begin(size, blocks, blockIndex + 1),
+                  blockIndex);
+    });
+}
+
+template<typename Operation>
+void parallel_for(size_t size,
+                  Operation operation,
+                  size_t min_block_size = default_min_block_size,
+                  size_t thread_count = hardware_thread_count())
+{
+    parallel_for_blocks(
+        size,
+        [&operation](size_t begin, size_t end, size_t) {
+            for (; begin != end; ++begin) {
+                operation(begin);
+            }
+        },
+        min_block_size,
+        thread_count);
+}
+} // namespace cpputility
+
+#endif // CPPUTILITY_PARALLEL_HPP
@@ -0,0 +1,81 @@
+/* NetSim Project - Numerical Simulation, Analysis and Optimization of District Heating Networks
+ *
+ * include/cpputility/prefetch.hpp
+ *
+ * created: 2026-10-19, Dominik Linn <d.linn@gmx.net> <dominik.linn@itwm.fraunhofer.de>
+ *
+ * (c) 2026 Dominik Linn, Fraunhofer ITWM
+ *
+ */
+
+#ifndef CPPUTILITY_PREFETCH_HPP
+#define CPPUTILITY_PREFETCH_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <xmmintrin.h>
+#endif
+
+namespace cpputility
+{
+using std::size_t;
+
+/// Number of elements for_each_batched prefetches ahead of the element being processed.
+constexpr size_t default_prefetch_distance = 16;
+
+/// Number of elements for_each_batched prefetches and processes at once.
+constexpr size_t default_prefetch_batch_size = 8;
+
+/// Hints the cache to load the line containing address, a no-op on unknown compilers.
+inline void prefetch(void const *address)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#elif defined(_MSC_VER)
+    _mm_prefetch(static_cast<char const *>(address), _MM_HINT_T0);
+#else
+    (void) address;
+#endif
+}
+
+/// Calls operation(element) for all elements of container in order, prefetching the elements
+/// distance positions ahead.
+///
+/// Meant for containers of indirectly stored elements like StorageVector and ReferenceVector,
+/// whose pointees the hardware prefetcher cannot predict. container[pos] only loads the pointer
+/// (taking the address of the returned reference does not touch the pointee), so the prefetches
+/// of a whole batch are issued back to back and their memory latencies overlap, before the
+/// elements of the current batch are processed.
+template<typename Container, typename Operation>
+void for_each_batched(Container &&container,
+                      Operation operation,
+                      size_t distance = default_prefetch_distance,
+                      size_t batch_size = default_prefetch_batch_size)
+{
+    auto const size = static_cast<size_t>(container.size());
+    auto const batchSize = std::max(batch_size, size_t{1});
+    auto const element = [&container](size_t pos) -> decltype(auto) {
+        return container[static_cast<ptrdiff_t>(pos)];
+    };
+
+    for (size_t pos = 0; pos < std::min(distance, size); ++pos) {
+        prefetch(std::addressof(element(pos)));
+    }
+
+    for (size_t begin = 0; begin < size; begin += batchSize) {
+        auto const end = std::min(begin + batchSize, size);
+        auto const prefetchEnd = std::min(end + distance, size);
+        for (auto pos = std::min(begin + distance, size); pos < prefetchEnd; ++pos) {
+            prefetch(std::addressof(element(pos)));
+        }
+        for (auto pos = begin; pos < end; ++pos) {
+            operation(element(pos));
+        }
+    }
+}
+} // namespace cpputility
+
+#endif // CPPUTILITY_PREFETCH_HPP
@@ -0,0 +1,245 @@
+/* NetSim Project - Numerical Simulation, Analysis and Optimization of District Heating Networks
+ *
+ * include/cpputility/reduction.hpp
+ *
+ * created: 2026-10-19, Dominik Linn <d.linn@gmx.net> <dominik.linn@itwm.fraunhofer.de>
+ *
+ * (c) 2026 Dominik Linn, Fraunhofer ITWM
+ *
+ */
+
+#ifndef CPPUTILITY_REDUCTION_HPP
+#define CPPUTILITY_REDUCTION_HPP
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cpputility/parallel.hpp>
+#include <cpputility/trace.hpp>
+
+namespace cpputility
+{
+/// Number of elements reduced into one leaf of the reduction tree. The tree only depends on the
+/// size of the range, never on the number of threads, which is what makes the results of the
+/// deterministic reductions bitwise reproducible.
+constexpr size_t reduction_leaf_size = 2048;
+
+/// Number of independent accumulators within a leaf. They keep several additions in flight and
+/// allow the compiler to vectorize, but fix the association order independently of the hardware.
+constexpr size_t reduction_lanes = 8;
+
+/// Running sum with Neumaier compensation: the rounding error of every addition is accumulated
+/// separately and added back by value(). Sums of many values of different magnitude are then
+/// almost as accurate as if they were computed exactly and rounded once.
+template<typename T>
+class CompensatedSum
+{
+private:
+    T m_sum{};
+    T m_compensation{};
+
+public:
+    CompensatedSum() = default;
+
+    CompensatedSum(T value) : m_sum{value} {}
+
+    CompensatedSum &operator+=(T value)
+    {
+        auto const sum = m_sum + value;
+        if (std::abs(m_sum) >= std::abs(value)) {
+            m_compensation += (m_sum - sum) + value;
+        } else {
+            m_compensation += (value - sum) + m_sum;
+        }
+        m_sum = sum;
+        return *this;
+    }
+
+    CompensatedSum &operator+=(CompensatedSum const &other)
+    {
+        *this += other.m_sum;
+        m_compensation += other.m_compensation;
+        return *this;
+    }
+
+    /// Adds lhs * rhs including the rounding error of the product.
+    CompensatedSum &add_product(T lhs, T rhs)
+    {
+        auto const product = lhs * rhs;
+        *this += product;
+        m_compensation += std::fma(lhs, rhs, -product);
+        return *this;
+    }
+
+    inline T value() const { return m_sum + m_compensation; }
+};
+
+template<typename T>
+CompensatedSum<T> operator+(CompensatedSum<T> lhs, CompensatedSum<T> const &rhs)
+{
+    return lhs += rhs;
+}
+
+namespace detail
+{
+/// Reduces values[0, count) in place along a balanced binary tree and returns the result.
+template<typename T, typename BinaryOp>
+T pairwise_reduce(T *values, size_t count, BinaryOp &op)
+{
+    for (size_t width = 1; width < count; width *= 2) {
+        for (size_t index = 0; index + width < count; index += 2 * width) {
+            values[index] = op(std::move(values[index]), std::move(values[index + width]));
+        }
+    }
+    return std::move(values[0]);
+}
+
+/// Element index is added to lane index % reduction_lanes (counted from begin), the lanes are
+/// combined pairwise.
+template<typename T, typename Load, typename BinaryOp>
+T reduce_leaf(size_t begin, size_t end, T const &identity, Load &load, BinaryOp &op)
+{
+    std::array<T, reduction_lanes> lanes;
+    lanes.fill(identity);
+
+    auto index = begin;
+    for (; index + reduction_lanes <= end; index += reduction_lanes) {
+        for (size_t lane = 0; lane < reduction_lanes; ++lane) {
+            lanes[lane] = op(std::move(lanes[lane]), load(index + lane));
+        }
+    }
+    for (size_t lane = 0; index != end; ++index, ++lane) {
+        lanes[lane] = op(std::move(lanes[lane]), load(index));
+    }
+    return pairwise_reduce(lanes.data(), lanes.size(), op);
+}
+
+template<typename Container>
+using reduction_value_t = typename std::decay_t<Container>::value_type;
+} // namespace detail
+
+/// Reduces load(0), ..., load(size - 1) with op, starting from identity.
+///
+/// [0, size) is cut into leaves of reduction_leaf_size elements, which are reduced concurrently,
+/// and the leaf results are combined along a balanced binary tree. Since leaves and tree are
+/// determined by size alone, the result is bitwise identical for every thread_count even for
+/// non-associative operations like floating point addition. identity has to be neutral for op.
+/// Every thread gets leaves of at least default_min_block_size elements, so small reductions stay
+/// on the calling thread.
+template<typename T, typename Load, typename BinaryOp>
+T deterministic_reduce(size_t size,
+                       T identity,
+                       Load load,
+                       BinaryOp op,
+                       size_t thread_count = hardware_thread_count())
+{
+    CPPUTILITY_TRACE_SCOPE("cpputility::deterministic_reduce");
+    auto const leaves = (size + reduction_leaf_size - 1) / reduction_leaf_size;
+    if (leaves == 0) {
+        return identity;
+    }
+
+    std::vector<T> partials(leaves, identity);
+    parallel_for(
+        leaves,
+        [&](size_t leaf) {
+            auto const begin = leaf * reduction_leaf_size;
+            auto const end = std::min(begin + reduction_leaf_size, size);
+            partials[leaf] = detail::reduce_leaf(begin, end, identity, load, op);
+        },
+        (default_min_block_size + reduction_leaf_size - 1) / reduction_leaf_size,
+        thread_count);
+    return detail::pairwise_reduce(partials.data(), partials.size(), op);
+}
+
+/// Sum of all elements, bitwise reproducible for every thread_count.
+template<typename Container>
+auto deterministic_sum(Container const &container, size_t thread_count = hardware_thread_count())
+{
+    using T = detail::reduction_value_t<Container>;
+    return deterministic_reduce(
+        static_cast<size_t>(container.size()),
+        T{},
+        [&container](size_t index) -> T { return container[static_cast<ptrdiff_t>(index)]; },
+        [](T sum, T const &value) { return sum + value; },
+        thread_count);
+}
+
+/// Sum of lhs[i] * rhs[i], bitwise reproducible for every thread_count.
+template<typename LhsContainer, typename RhsContainer>
+auto deterministic_dot(LhsContainer const &lhs,
+                       RhsContainer const &rhs,
+                       size_t thread_count = hardware_thread_count())
+{
+    using T = detail::reduction_value_t<LhsContainer>;
+    assert(lhs.size() == rhs.size());
+    return deterministic_reduce(
+        static_cast<size_t>(lhs.size()),
+        T{},
+        [&lhs, &rhs](size_t index) -> T {
+            auto const pos = static_cast<ptrdiff_t>(index);
+            return lhs[pos] * rhs[pos];
+        },
+        [](T sum, T const &value) { return sum + value; },
+        thread_count);
+}
+
+/// Euclidean norm, bitwise reproducible for every thread_count.
+template<typename Container>
+auto deterministic_norm(Container const &container, size_t thread_count = hardware_thread_count())
+{
+    return std::sqrt(deterministic_dot(container, container, thread_count));
+}
+
+/// Like deterministic_sum, but every leaf and the tree accumulate with CompensatedSum, which makes
+/// the result almost independent of the summation order and thereby close to the exact sum.
+template<typename Container>
+auto compensated_sum(Container const &container, size_t thread_count = hardware_thread_count())
+{
+    using T = detail::reduction_value_t<Container>;
+    return deterministic_reduce(
+               static_cast<size_t>(container.size()),
+               CompensatedSum<T>{},
+               [&container](size_t index) {
+                   return CompensatedSum<T>(container[static_cast<ptrdiff_t>(index)]);
+               },
+               [](CompensatedSum<T> sum, CompensatedSum<T> const &value) { return sum += value; },
+               thread_count)
+        .value();
+}
+
+/// Like deterministic_dot, but products and sums are compensated (the Dot2 algorithm).
+template<typename LhsContainer, typename RhsContainer>
+auto compensated_dot(LhsContainer const &lhs,
+                     RhsContainer const &rhs,
+                     size_t thread_count = hardware_thread_count())
+{
+    using T = detail::reduction_value_t<LhsContainer>;
+    assert(lhs.size() == rhs.size());
+    return deterministic_reduce(
+               static_cast<size_t>(lhs.size()),
+               CompensatedSum<T>{},
+               [&lhs, &rhs](size_t index) {
+                   auto const pos = static_cast<ptrdiff_t>(index);
+                   return CompensatedSum<T>{}.add_product(lhs[pos], rhs[pos]);
+               },
+               [](CompensatedSum<T> sum, CompensatedSum<T> const &value) { return sum += value; },
+               thread_count)
+        .value();
+}
+
+/// Euclidean norm computed from compensated_dot.
+template<typename Container>
+auto compensated_norm(Container const &container, size_t thread_count = hardware_thread_count())
+{
+    return std::sqrt(compensated_dot(container, container, thread_count));
+}
+} // namespace cpputility
+
+#endif // CPPUTILITY_REDUCTION_HPP
@@ -0,0 +1,318 @@
+/* NetSim Project - Numerical Simulation, Analysis and Optimization of District Heating Networks
+ *
+ * include/cpputility/scan.hpp
+ *
+ * created: 2026-10-19, Dominik Linn <d.linn@gmx.net> <dominik.linn@itwm.fraunhofer.de>
+ *
+ * (c) 2026 Dominik Linn, Fraunhofer ITWM
+ *
+ */
+
+#ifndef CPPUTILITY_SCAN_HPP
+#define CPPUTILITY_SCAN_HPP
+
+#include <cstddef>
+#include <functional>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cpputility/parallel.hpp>
+#include <cpputility/trace.hpp>
+
+namespace cpputility
+{
+namespace detail
+{
+/// Three phase blocked scan: every block is reduced concurrently, the block sums are scanned
+/// serially and finally every block is scanned concurrently starting from its carry.
+///
+/// load(index) returns the element at index, store(index, before, after) receives the prefix
+/// before the element (nullptr for the very first element if init is empty) and the prefix
+/// including the element. load(index) is always called before store(index, ...), so input and
+/// output may alias.
+template<typename T, typename Load, typename BinaryOp, typename Store>
+void blocked_scan(size_t size,
+                  std::optional<T> init,
+                  Load load,
+                  BinaryOp op,
+                  Store store,
+                  size_t thread_count)
+{
+    CPPUTILITY_TRACE_SCOPE("cpputility::blocked_scan");
+    if (size == 0) {
+        return;
+    }
+
+    auto const blocks = block_count(size, default_min_block_size, thread_count);
+
+    std::vector<std::optional<T>> carries(blocks);
+    carries.front() = std::move(init);
+
+    if (blocks > 1) {
+        std::vector<std::optional<T>> sums(blocks);
+        parallel_invoke_n(blocks - 1, [&](size_t blockIndex) {
+            auto const end = block_begin(size, blocks, blockIndex + 1);
+            auto index = block_begin(size, blocks, blockIndex);
+            T sum = load(index);
+            for (++index; index != end; ++index) {
+                sum = op(std::move(sum), load(index));
+            }
+            sums[blockIndex] = std::move(sum);
+        });
+
+        for (size_t blockIndex = 1; blockIndex < blocks; ++blockIndex) {
+            auto const &carry = carries[blockIndex - 1];
+            carries[blockIndex] = carry ? op(*carry, *sums[blockIndex - 1]) : *sums[blockIndex - 1];
+        }
+    }
+
+    parallel_invoke_n(blocks, [&](size_t blockIndex) {
+        auto const end = block_begin(size, blocks, blockIndex + 1);
+        auto index = block_begin(size, blocks, blockIndex);
+        auto &carry = carries[blockIndex];
+
+        if (!carry) {
+            T value = load(index);
+            store(index, static_cast<T const *>(nullptr), value);
+            carry = std::move(value);
+            ++index;
+        }
+
+        T prefix = std::move(*carry);
+        for (; index != end; ++index) {
+            T next = op(prefix, load(index));
+            store(index, &prefix, next);
+            prefix = std::move(next);
+        }
+    });
+}
+
+template<typename T>
+struct Segmented
+{
+    bool head;
+    T value;
+};
+
+/// Lifts op to (head, value) pairs, a set head flag restarts the accumulation. The lifted
+/// operation is associative if op is, which allows segmented scans to use blocked_scan.
+template<typename T, typename BinaryOp>
+auto segmented_op(BinaryOp op)
+{
+    return [op](Segmented<T> const &lhs, Segmented<T> const &rhs) {
+        if (rhs.head) {
+            return rhs;
+        }
+        return Segmented<T>{lhs.head, op(lhs.value, rhs.value)};
+    };
+}
+
+template<typename Container>
+using scan_value_t = typename std::decay_t<Container>::value_type;
+
+template<typename OffsetContainer>
+std::vector<char> offsets_to_flags(size_t size, OffsetContainer const &offsets)
+{
+    std::vector<char> flags(size, 0);
+    for (ptrdiff_t index = 0; index < static_cast<ptrdiff_t>(offsets.size()); ++index) {
+        auto const offset = static_cast<size_t>(offsets[index]);
+        if (offset < size) {
+            flags[offset] = 1;
+        }
+    }
+    return flags;
+}
+} // namespace detail
+
+/// output[i] = input[0] op ... op input[i]. op has to be associative, input and output may be the
+/// same range.
+///
+/// Named blocked_* rather than inclusive_scan, which argument dependent lookup would resolve to
+/// std::inclusive_scan for unqualified calls on std containers.
+template<typename InputContainer, typename OutputContainer, typename BinaryOp = std::plus<>>
+void blocked_inclusive_scan(InputContainer const &input,
+                            OutputContainer &&output,
+                            BinaryOp op = BinaryOp{},
+                            size_t thread_count = hardware_thread_count())
+{
+    using T = detail::scan_value_t<OutputContainer>;
+    detail::blocked_scan<T>(
+        static_cast<size_t>(input.size()),
+        std::nullopt,
+        [&input](size_t index) -> T { return input[static_cast<ptrdiff_t>(index)]; },
+        op,
+        [&output](size_t index, T const *, T const &after) {
+            output[static_cast<ptrdiff_t>(index)] = after;
+        },
+        thread_count);
+}
+
+/// output[i] = init op input[0] op ... op input[i - 1].
+template<typename InputContainer,
+         typename OutputContainer,
+         typename T,
+         typename BinaryOp = std::plus<>>
+void blocked_exclusive_scan(InputContainer const &input,
+                            OutputContainer &&output,
+                            T init,
+                            BinaryOp op = BinaryOp{},
+                            size_t thread_count = hardware_thread_count())
+{
+    using ValueT = detail::scan_value_t<OutputContainer>;
+    detail::blocked_scan<ValueT>(
+        static_cast<size_t>(input.size()),
+        ValueT(std::move(init)),
+        [&input](size_t index) -> ValueT { return input[static_cast<ptrdiff_t>(index)]; },
+        op,
+        [&output](size_t index, ValueT const *before, ValueT const &) {
+            output[static_cast<ptrdiff_t>(index)] = *before;
+        },
+        thread_count);
+}
+
+/// Inclusive scan restarting at every index whose flag is set.
+template<typename InputContainer,
+         typename FlagContainer,
+         typename OutputContainer,
+         typename BinaryOp = std::plus<>>
+void segmented_inclusive_scan(InputContainer const &input,
+                              FlagContainer const &flags,
+                              OutputContainer &&output,
+                              BinaryOp op = BinaryOp{},
+                              size_t thread_count = hardware_thread_count())
+{
+    using T = detail::scan_value_t<OutputContainer>;
+    using Segmented = detail::Segmented<T>;
+    detail::blocked_scan<Segmented>(
+        static_cast<size_t>(input.size()),
+        std::nullopt,
+        [&](size_t index) {
+            auto const pos = static_cast<ptrdiff_t>(index);
+            return Segmented{static_cast<bool>(flags[pos]), input[pos]};
+        },
+        detail::segmented_op<T>(op),
+        [&output](size_t index, Segmented const *, Segmented const &after) {
+            output[static_cast<ptrdiff_t>(index)] = after.value;
+        },
+        thread_count);
+}
+
+/// Exclusive scan restarting with init at every index whose flag is set.
+template<typename InputContainer,
+         typename FlagContainer,
+         typename OutputContainer,
+         typename T,
+         typename BinaryOp = std::plus<>>
+void segmented_exclusive_scan(InputContainer const &input,
+                              FlagContainer const &flags,
+                              OutputContainer &&output,
+                              T init,
+                              BinaryOp op = BinaryOp{},
+                              size_t thread_count = hardware_thread_count())
+{
+    using ValueT = detail::scan_value_t<OutputContainer>;
+    using Segmented = detail::Segmented<ValueT>;
+    ValueT const initValue(std::move(init));
+    detail::blocked_scan<Segmented>(
+        static_cast<size_t>(input.size()),
+        std::nullopt,
+        [&](size_t index) {
+            auto const pos = static_cast<ptrdiff_t>(index);
+            return Segmented{static_cast<bool>(flags[pos]), input[pos]};
+        },
+        detail::segmented_op<ValueT>(op),
+        [&](size_t index, Segmented const *before, Segmented const &) {
+            auto const pos = static_cast<ptrdiff_t>(index);
+            output[pos] = (before == nullptr || flags[pos]) ? initValue
+                                                            : op(initValue, before->value);
+        },
+        thread_count);
+}
+
+/// Segmented inclusive scan with segments given by their (CSR style) start offsets.
+template<typename InputContainer,
+         typename OffsetContainer,
+         typename OutputContainer,
+         typename BinaryOp = std::plus<>>
+void segmented_inclusive_scan_offsets(InputContainer const &input,
+                                      OffsetContainer const &offsets,
+                                      OutputContainer &&output,
+                                      BinaryOp op = BinaryOp{},
+                                      size_t thread_count = hardware_thread_count())
+{
+    auto const flags = detail::offsets_to_flags(static_cast<size_t>(input.size()), offsets);
+    segmented_inclusive_scan(input, flags, output, op, thread_count);
+}
+
+template<typename InputContainer,
+         typename OffsetContainer,
+         typename OutputContainer,
+         typename T,
+         typename BinaryOp = std::plus<>>
+void segmented_exclusive_scan_offsets(InputContainer const &input,
+                                      OffsetContainer const &offsets,
+                                      OutputContainer &&output,
+                                      T init,
+                                      BinaryOp op = BinaryOp{},
+                                      size_t thread_count = hardware_thread_count())
+{
+    auto const flags = detail::offsets_to_flags(static_cast<size_t>(input.size()), offsets);
+    segmented_exclusive_scan(input, flags, output, std::move(init), op, thread_count);
+}
+
+/// Reduces every run of equal consecutive keys to a single key/value pair. The output containers
+/// must be large enough to hold one entry per run. Returns the number of runs.
+template<typename KeyContainer,
+         typename ValueContainer,
+         typename KeyOutputContainer,
+         typename ValueOutputContainer,
+         typename BinaryOp = std::plus<>>
+size_t reduce_by_key(KeyContainer const &keys,
+                     ValueContainer const &values,
+                     KeyOutputContainer &&keys_out,
+                     ValueOutputContainer &&values_out,
+                     BinaryOp op = BinaryOp{},
+                     size_t thread_count = hardware_thread_count())
+{
+    CPPUTILITY_TRACE_SCOPE("cpputility::reduce_by_key");
+    using T = detail::scan_value_t<ValueOutputContainer>;
+    auto const size = static_cast<size_t>(keys.size());
+    if (size == 0) {
+        return 0;
+    }
+
+    std::vector<char> heads(size);
+    parallel_for(
+        size,
+        [&](size_t index) {
+            auto const pos = static_cast<ptrdiff_t>(index);
+            heads[index] = (index == 0) || !(keys[pos] == keys[pos - 1]);
+        },
+        default_min_block_size,
+        thread_count);
+
+    std::vector<size_t> runIndices(size);
+    blocked_inclusive_scan(heads, runIndices, std::plus<>{}, thread_count);
+
+    std::vector<T> sums(size);
+    segmented_inclusive_scan(values, heads, sums, op, thread_count);
+
+    parallel_for(
+        size,
+        [&](size_t index) {
+            if (index + 1 == size || heads[index + 1]) {
+                auto const run = static_cast<ptrdiff_t>(runIndices[index] - 1);
+                keys_out[run] = keys[static_cast<ptrdiff_t>(index)];
+                values_out[run] = std::move(sums[index]);
+            }
+        },
+        default_min_block_size,
+        thread_count);
+
+    return runIndices.back();
+}
+} // namespace cpputility
+
+#endif // CPPUTILITY_SCAN_HPP
@@ -0,0 +1,136 @@
+/* NetSim Project - Numerical Simulation, Analysis and Optimization of District Heating Networks
+ *
+ * include/cpputility/selection.hpp
+ *
+ * created: 2026-10-19, Dominik Linn <d.linn@gmx.net> <dominik.linn@itwm.fraunhofer.de>
+ *
+ * (c) 2026 Dominik Linn, Fraunhofer ITWM
+ *
+ */
+
+#ifndef CPPUTILITY_SELECTION_HPP
+#define CPPUTILITY_SELECTION_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <cpputility/bits.hpp>
+#include <cpputility/trace.hpp>
+
+namespace cpputility
+{
+/// Evaluates pred for every element of the container into 64 bit words, without branching on the
+/// outcome, and calls operation(word, bits) for every word in ascending order. Bit i of word w
+/// belongs to element w * bits_per_word + i.
+template<typename Container, typename Predicate, typename Operation>
+void for_each_mask_word(Container const &container, Predicate pred, Operation operation)
+{
+    auto const size = static_cast<size_t>(container.size());
+    for (size_t word = 0; word < word_count(size); ++word) {
+        auto const begin = word * bits_per_word;
+        auto const end = std::min(begin + bits_per_word, size);
+        std::uint64_t bits = 0;
+        for (auto index = begin; index < end; ++index) {
+            bool const selected = pred(container[static_cast<ptrdiff_t>(index)]);
+            bits |= static_cast<std::uint64_t>(selected) << (index - begin);
+        }
+        operation(word, bits);
+    }
+}
+
+/// Indices of the elements of a container satisfying a predicate, stored both as bitmask and as
+/// compacted index list. A selection can be reused for several operations and re-assigned without
+/// reallocating, e.g. once per timestep.
+class Selection
+{
+private:
+    std::vector<std::uint64_t> m_mask;
+    std::vector<size_t> m_indices;
+    size_t m_size = 0;
+
+public:
+    Selection() = default;
+
+    template<typename Container, typename Predicate>
+    Selection(Container const &container, Predicate pred)
+    {
+        assign(container, pred);
+    }
+
+    /// Evaluates pred for every element into the bitmask (without branching on the result) and
+    /// compacts the set bits into the index list.
+    template<typename Container, typename Predicate>
+    void assign(Container const &container, Predicate pred)
+    {
+        m_size = static_cast<size_t>(container.size());
+        m_mask.resize(word_count(m_size));
+
+        size_t count = 0;
+        for_each_mask_word(container, pred, [this, &count](size_t word, std::uint64_t bits) {
+            m_mask[word] = bits;
+            count += popcount(bits);
+        });
+
+        m_indices.resize(count);
+        auto position = m_indices.begin();
+        for (size_t word = 0; word < m_mask.size(); ++word) {
+            for_each_set_bit(m_mask[word], word * bits_per_word, [&position](size_t index) {
+                *position++ = index;
+            });
+        }
+    }
+
+    void clear()
+    {
+        m_mask.clear();
+        m_indices.clear();
+        m_size = 0;
+    }
+
+    /// Size of the container the selection was computed for.
+    inline size_t size() const { return m_size; }
+
+    /// Number of selected elements.
+    inline size_t count() const { return m_indices.size(); }
+
+    inline bool empty() const { return m_indices.empty(); }
+
+    inline bool contains(size_t index) const
+    {
+        return (m_mask[index / bits_per_word] >> (index % bits_per_word)) & 1;
+    }
+
+    inline std::vector<size_t> const &indices() const { return m_indices; }
+
+    inline std::vector<std::uint64_t> const &mask() const { return m_mask; }
+};
+
+template<typename Container, typename Predicate>
+Selection select_if(Container const &container, Predicate pred)
+{
+    CPPUTILITY_TRACE_SCOPE("cpputility::select_if");
+    return Selection(container, pred);
+}
+
+/// Calls op for every selected element of the container, which has to be the container (or one of
+/// equal size) the selection was computed for.
+template<typename Container, typename Operation>
+void for_each_selected(Container &&container, Selection const &selection, Operation op)
+{
+    for (auto const index : selection.indices()) {
+        op(container[static_cast<ptrdiff_t>(index)]);
+    }
+}
+
+/// Two phase variant of for_each_if, which evaluates pred for all elements first and then applies
+/// op to the selected ones only. Pays off if the predicate outcome is hard to predict.
+template<typename Container, typename Predicate, typename Operation>
+void for_each_if_compacted(Container &&container, Predicate pred, Operation op)
+{
+    for_each_selected(container, select_if(container, pred), op);
+}
+} // namespace cpputility
+
+#endif // CPPUTILITY_SELECTION_HPP
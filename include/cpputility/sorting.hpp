@@ -0,0 +1,370 @@
+/* NetSim Project - Numerical Simulation, Analysis and Optimization of District Heating Networks
+ *
+ * include/cpputility/sorting.hpp
+ *
+ * created: 2026-10-19, Dominik Linn <d.linn@gmx.net> <dominik.linn@itwm.fraunhofer.de>
+ *
+ * (c) 2026 Dominik Linn, Fraunhofer ITWM
+ *
+ */
+
+#ifndef CPPUTILITY_SORTING_HPP
+#define CPPUTILITY_SORTING_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cpputility/containers/reference_vector.hpp>
+#include <cpputility/containers/storage_vector.hpp>
+#include <cpputility/parallel.hpp>
+#include <cpputility/trace.hpp>
+
+namespace cpputility
+{
+namespace detail
+{
+template<typename T>
+struct is_storage_vector : std::false_type
+{
+};
+
+template<typename BaseT, typename DelT, typename AllocT>
+struct is_storage_vector<StorageVector<BaseT, DelT, AllocT>> : std::true_type
+{
+};
+
+template<typename T>
+struct is_reference_vector : std::false_type
+{
+};
+
+template<typename BaseT, typename AllocT>
+struct is_reference_vector<ReferenceVector<BaseT, AllocT>> : std::true_type
+{
+};
+
+/// Containers whose elements are reached through an array of handles, which reordering algorithms
+/// permute instead of the elements themselves.
+template<typename Container>
+constexpr bool is_indirect_container_v = is_storage_vector<std::decay_t<Container>>::value
+                                         || is_reference_vector<std::decay_t<Container>>::value;
+
+/// The owning pointers of a StorageVector or the references of a ReferenceVector.
+template<typename Container>
+auto &handles(Container &container)
+{
+    if constexpr (is_storage_vector<std::decay_t<Container>>::value) {
+        return container.get_pointers();
+    } else {
+        return container.get_references();
+    }
+}
+
+template<typename T, typename DelT>
+inline T &dereference(std::unique_ptr<T, DelT> const &pointer)
+{
+    return *pointer;
+}
+
+template<typename T>
+inline T &dereference(std::reference_wrapper<T> reference)
+{
+    return reference.get();
+}
+
+/// Calls operation(first, last, function) on the range of the container. For a StorageVector or a
+/// ReferenceVector the range is its array of handles and function is wrapped to act on the
+/// referred objects, so reordering algorithms only move pointers and never the objects, which may
+/// be owned elsewhere.
+template<typename Container, typename Function, typename Operation>
+decltype(auto) apply_to_range(Container &container, Function function, Operation operation)
+{
+    if constexpr (is_indirect_container_v<Container>) {
+        auto &range = handles(container);
+        return operation(range.begin(), range.end(), [&function](auto const &... handle) {
+            return function(dereference(handle)...);
+        });
+    } else {
+        return operation(container.begin(), container.end(), function);
+    }
+}
+
+/// Sorts blocks of [first, last) concurrently and merges them pairwise in a tree, every level of
+/// the tree concurrently. std::inplace_merge is stable, so the result is stable if Stable is set.
+template<bool Stable, typename RandomIt, typename Compare>
+void parallel_merge_sort(RandomIt first, RandomIt last, Compare comp, size_t thread_count)
+{
+    auto const size = static_cast<size_t>(last - first);
+    auto const blocks = block_count(size, default_min_block_size, thread_count);
+    auto const blockIter = [&](size_t blockIndex) {
+        return first + static_cast<ptrdiff_t>(block_begin(size, blocks, blockIndex));
+    };
+
+    parallel_invoke_n(blocks, [&](size_t blockIndex) {
+        if constexpr (Stable) {
+            std::stable_sort(blockIter(blockIndex), blockIter(blockIndex + 1), comp);
+        } else {
+            std::sort(blockIter(blockIndex), blockIter(blockIndex + 1), comp);
+        }
+    });
+
+    for (size_t width = 1; width < blocks; width *= 2) {
+        auto const merges = (blocks + 2 * width - 1) / (2 * width);
+        parallel_invoke_n(merges, [&](size_t mergeIndex) {
+            auto const low = 2 * width * mergeIndex;
+            auto const middle = std::min(low + width, blocks);
+            auto const high = std::min(low + 2 * width, blocks);
+            if (middle < high) {
+                std::inplace_merge(blockIter(low), blockIter(middle), blockIter(high), comp);
+            }
+        });
+    }
+}
+
+/// Stable partition of blocks of [first, last) concurrently, afterwards neighbouring blocks are
+/// joined pairwise by rotating the false part of the left block behind the true part of the right
+/// one. Returns the offset of the partition point.
+template<typename RandomIt, typename Predicate>
+ptrdiff_t parallel_stable_partition(RandomIt first,
+                                    RandomIt last,
+                                    Predicate pred,
+                                    size_t thread_count)
+{
+    auto const size = static_cast<size_t>(last - first);
+    auto const blocks = block_count(size, default_min_block_size, thread_count);
+    auto const blockIter = [&](size_t blockIndex) {
+        return first + static_cast<ptrdiff_t>(block_begin(size, blocks, blockIndex));
+    };
+
+    // partitionPoints[b] holds the partition point of the joined range starting at block b
+    std::vector<RandomIt> partitionPoints(blocks, first);
+    parallel_invoke_n(blocks, [&](size_t blockIndex) {
+        partitionPoints[blockIndex] = std::stable_partition(blockIter(blockIndex),
+                                                            blockIter(blockIndex + 1),
+                                                            pred);
+    });
+
+    for (size_t width = 1; width < blocks; width *= 2) {
+        auto const merges = (blocks + 2 * width - 1) / (2 * width);
+        parallel_invoke_n(merges, [&](size_t mergeIndex) {
+            auto const low = 2 * width * mergeIndex;
+            auto const middle = low + width;
+            if (middle < blocks) {
+                partitionPoints[low] = std::rotate(partitionPoints[low],
+                                                   blockIter(middle),
+                                                   partitionPoints[middle]);
+            }
+        });
+    }
+
+    return partitionPoints.front() - first;
+}
+
+template<typename KeyT, typename Enable = void>
+struct radix_traits;
+
+template<typename KeyT>
+struct radix_traits<KeyT, std::enable_if_t<std::is_integral_v<KeyT>>>
+{
+    using unsigned_type = std::make_unsigned_t<KeyT>;
+
+    static unsigned_type to_unsigned(KeyT key)
+    {
+        auto const bits = static_cast<unsigned_type>(key);
+        if constexpr (std::is_signed_v<KeyT>) {
+            return bits ^ (unsigned_type{1} << (std::numeric_limits<unsigned_type>::digits - 1));
+        } else {
+            return bits;
+        }
+    }
+};
+
+template<typename KeyT>
+struct radix_traits<KeyT, std::enable_if_t<std::is_floating_point_v<KeyT>>>
+{
+    static_assert(sizeof(KeyT) == sizeof(std::uint32_t) || sizeof(KeyT) == sizeof(std::uint64_t),
+                  "radix sort supports 32 and 64 bit floating point keys only");
+
+    using unsigned_type
+        = std::conditional_t<sizeof(KeyT) == sizeof(std::uint32_t), std::uint32_t, std::uint64_t>;
+
+    /// Maps the IEEE 754 representation to an unsigned integer with the same ordering.
+    static unsigned_type to_unsigned(KeyT key)
+    {
+        unsigned_type bits;
+        std::memcpy(&bits, &key, sizeof(bits));
+        auto const signBit = unsigned_type{1} << (std::numeric_limits<unsigned_type>::digits - 1);
+        return (bits & signBit) ? ~bits : (bits | signBit);
+    }
+};
+
+/// Stable LSD radix sort of the keys with 8 bit digits, returns the sorting permutation.
+/// Passes in which all keys share the same digit are skipped.
+template<typename UnsignedT>
+std::vector<size_t> radix_sort_order(std::vector<UnsignedT> &keys)
+{
+    constexpr unsigned radixBits = 8;
+    constexpr size_t radixSize = size_t{1} << radixBits;
+
+    auto const size = keys.size();
+    std::vector<size_t> order(size);
+    std::iota(order.begin(), order.end(), size_t{0});
+    std::vector<size_t> orderBuffer(size);
+    std::vector<UnsignedT> keyBuffer(size);
+
+    for (unsigned shift = 0; shift < std::numeric_limits<UnsignedT>::digits; shift += radixBits) {
+        std::array<size_t, radixSize> offsets{};
+        for (auto const key : keys) {
+            ++offsets[(key >> shift) & (radixSize - 1)];
+        }
+        if (std::find(offsets.begin(), offsets.end(), size) != offsets.end()) {
+            continue;
+        }
+
+        size_t offset = 0;
+        for (auto &count : offsets) {
+            offset += std::exchange(count, offset);
+        }
+
+        for (size_t index = 0; index < size; ++index) {
+            auto const target = offsets[(keys[index] >> shift) & (radixSize - 1)]++;
+            keyBuffer[target] = keys[index];
+            orderBuffer[target] = order[index];
+        }
+        keys.swap(keyBuffer);
+        order.swap(orderBuffer);
+    }
+
+    return order;
+}
+} // namespace detail
+
+/// Sorts the container in parallel. A StorageVector is sorted by reordering its owning pointers, a
+/// ReferenceVector by reordering its references.
+template<typename Container, typename Compare = std::less<>>
+void parallel_sort(Container &&container,
+                   Compare comp = Compare{},
+                   size_t thread_count = hardware_thread_count())
+{
+    CPPUTILITY_TRACE_SCOPE("cpputility::parallel_sort");
+    detail::apply_to_range(container, comp, [thread_count](auto first, auto last, auto compare) {
+        detail::parallel_merge_sort<false>(first, last, compare, thread_count);
+    });
+}
+
+/// Stable variant of parallel_sort.
+template<typename Container, typename Compare = std::less<>>
+void parallel_stable_sort(Container &&container,
+                          Compare comp = Compare{},
+                          size_t thread_count = hardware_thread_count())
+{
+    CPPUTILITY_TRACE_SCOPE("cpputility::parallel_stable_sort");
+    detail::apply_to_range(container, comp, [thread_count](auto first, auto last, auto compare) {
+        detail::parallel_merge_sort<true>(first, last, compare, thread_count);
+    });
+}
+
+template<typename Container, typename Compare = std::less<>>
+void nth_element(Container &&container, ptrdiff_t nth, Compare comp = Compare{})
+{
+    detail::apply_to_range(container, comp, [nth](auto first, auto last, auto compare) {
+        std::nth_element(first, first + nth, last, compare);
+    });
+}
+
+/// Reorders the container such that all elements satisfying pred precede the others, returns the
+/// position of the first element not satisfying pred.
+template<typename Container, typename Predicate>
+ptrdiff_t partition(Container &&container, Predicate pred)
+{
+    return detail::apply_to_range(container, pred, [](auto first, auto last, auto predicate) {
+        return std::partition(first, last, predicate) - first;
+    });
+}
+
+template<typename Container, typename Predicate>
+ptrdiff_t stable_partition(Container &&container, Predicate pred)
+{
+    return detail::apply_to_range(container, pred, [](auto first, auto last, auto predicate) {
+        return std::stable_partition(first, last, predicate) - first;
+    });
+}
+
+/// Stable partition computed in parallel.
+template<typename Container, typename Predicate>
+ptrdiff_t parallel_partition(Container &&container,
+                             Predicate pred,
+                             size_t thread_count = hardware_thread_count())
+{
+    CPPUTILITY_TRACE_SCOPE("cpputility::parallel_partition");
+    return detail::apply_to_range(container,
+                                  pred,
+                                  [thread_count](auto first, auto last, auto predicate) {
+                                      return detail::parallel_stable_partition(first,
+                                                                               last,
+                                                                               predicate,
+                                                                               thread_count);
+                                  });
+}
+
+/// Stable radix sort by an integral or floating point key. The keys are computed once per element
+/// and in parallel, afterwards the elements (or the handles of a StorageVector or ReferenceVector)
+/// are permuted in a single pass.
+template<typename Container, typename KeyFunction>
+void radix_sort_by_key(Container &&container,
+                       KeyFunction key,
+                       size_t thread_count = hardware_thread_count())
+{
+    CPPUTILITY_TRACE_SCOPE("cpputility::radix_sort_by_key");
+    using ContainerT = std::decay_t<Container>;
+    using KeyT = std::decay_t<decltype(key(container[0]))>;
+    using Traits = detail::radix_traits<KeyT>;
+
+    auto const size = static_cast<size_t>(container.size());
+    std::vector<typename Traits::unsigned_type> keys(size);
+    parallel_for(
+        size,
+        [&](size_t index) {
+            keys[index] = Traits::to_unsigned(key(container[static_cast<ptrdiff_t>(index)]));
+        },
+        default_min_block_size,
+        thread_count);
+
+    auto const order = detail::radix_sort_order(keys);
+
+    if constexpr (detail::is_indirect_container_v<ContainerT>) {
+        auto &handles = detail::handles(container);
+        std::remove_reference_t<decltype(handles)> sorted(handles.get_allocator());
+        sorted.reserve(size);
+        for (auto const index : order) {
+            sorted.emplace_back(std::move(handles[index]));
+        }
+        handles.swap(sorted);
+    } else {
+        std::vector<typename ContainerT::value_type> sorted;
+        sorted.reserve(size);
+        for (auto const index : order) {
+            sorted.emplace_back(std::move(container[static_cast<ptrdiff_t>(index)]));
+        }
+        std::move(sorted.begin(), sorted.end(), container.begin());
+    }
+}
+
+/// Radix sort of a container of integral or floating point values.
+template<typename Container>
+void radix_sort(Container &&container, size_t thread_count = hardware_thread_count())
+{
+    radix_sort_by_key(container, [](auto const &value) { return value; }, thread_count);
+}
+} // namespace cpputility
+
+#endif // CPPUTILITY_SORTING_HPP
@@ -0,0 +1,429 @@
+/* NetSim Project - Numerical Simulation, Analysis and Optimization of District Heating Networks
+ *
+ * include/cpputility/task_graph.hpp
+ *
+ * created: 2026-10-19, Dominik Linn <d.linn@gmx.net> <dominik.linn@itwm.fraunhofer.de>
+ *
+ * (c) 2026 Dominik Linn, Fraunhofer ITWM
+ *
+ */
+
+#ifndef CPPUTILITY_TASK_GRAPH_HPP
+#define CPPUTILITY_TASK_GRAPH_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <cpputility/containers/vector_slice.hpp>
+#include <cpputility/parallel.hpp>
+#include <cpputility/trace.hpp>
+
+namespace cpputility
+{
+/// Directed acyclic graph of tasks, executed by a TaskScheduler.
+///
+/// A task consists of one or more chunks which may run concurrently, e.g. one per VectorSlice of
+/// a partitioned vector; its dependents start once all chunks finished. The graph is built once
+/// and can be run any number of times, a run only resets one counter per task.
+class TaskGraph
+{
+    friend class TaskScheduler;
+
+public:
+    using TaskId = size_t;
+
+private:
+    struct Task
+    {
+        std::function<void(size_t)> work;
+        size_t chunks;
+        char const *name;
+        std::vector<TaskId> successors;
+        size_t dependencies = 0;
+    };
+
+    std::vector<Task> m_tasks;
+    std::unique_ptr<std::atomic<size_t>[]> m_pendingDependencies;
+    std::unique_ptr<std::atomic<size_t>[]> m_pendingChunks;
+    bool m_prepared = false;
+
+public:
+    TaskGraph() = default;
+
+    inline size_t size() const { return m_tasks.size(); }
+
+    inline bool empty() const { return m_tasks.empty(); }
+
+    /// Adds a task running work() once. name shows up in traces and has to outlive the graph.
+    TaskId add_task(std::function<void()> work, char const *name = "cpputility::task")
+    {
+        return add_chunked_task(1, [work = std::move(work)](size_t) { work(); }, name);
+    }
+
+    TaskId add_task(std::function<void()> work,
+                    std::initializer_list<TaskId> dependencies,
+                    char const *name = "cpputility::task")
+    {
+        auto const task = add_task(std::move(work), name);
+        for (auto dependency : dependencies) {
+            add_dependency(task, dependency);
+        }
+        return task;
+    }
+
+    /// Adds a task running work(chunk) for every chunk in [0, chunks), concurrently.
+    TaskId add_chunked_task(size_t chunks,
+                            std::function<void(size_t)> work,
+                            char const *name = "cpputility::task")
+    {
+        m_tasks.push_back(Task{std::move(work), std::max(chunks, size_t{1}), name, {}, 0});
+        m_prepared = false;
+        return m_tasks.size() - 1;
+    }
+
+    /// Adds a task calling operation(slice) for consecutive VectorSlices of at most chunk_size
+    /// elements of vec. The partition is fixed to the size of vec when the task is added.
+    template<class VectorT, typename Operation>
+    TaskId add_partitioned_task(VectorT &vec,
+                                size_t chunk_size,
+                                Operation operation,
+                                char const *name = "cpputility::task")
+    {
+        auto const size = static_cast<size_t>(vec.size());
+        auto const chunkSize = std::max(chunk_size, size_t{1});
+        auto const chunks = (size + chunkSize - 1) / chunkSize;
+        return add_chunked_task(
+            chunks,
+            [&vec, size, chunkSize, operation = std::move(operation)](size_t chunk) {
+                auto const begin = std::min(chunk * chunkSize, size);
+                auto const end = std::min(begin + chunkSize, size);
+                operation(VectorSlice<VectorT>(vec,
+                                               static_cast<ptrdiff_t>(begin),
+                                               static_cast<ptrdiff_t>(end)));
+            },
+            name);
+    }
+
+    /// task starts only after dependency finished. Throws std::out_of_range for unknown tasks and
+    /// std::invalid_argument if task would depend on itself.
+    void add_dependency(TaskId task, TaskId dependency)
+    {
+        if (task >= m_tasks.size() || dependency >= m_tasks.size()) {
+            throw std::out_of_range("cpputility::TaskGraph::add_dependency: unknown task");
+        }
+        if (task == dependency) {
+            throw std::invalid_argument("cpputility::TaskGraph::add_dependency: self dependency");
+        }
+        m_tasks[dependency].successors.push_back(task);
+        ++m_tasks[task].dependencies;
+        m_prepared = false;
+    }
+
+    void clear()
+    {
+        m_tasks.clear();
+        m_prepared = false;
+    }
+
+private:
+    /// (Re)allocates the counters after the structure changed. Throws std::invalid_argument if the
+    /// graph contains a cycle, since its tasks would never start and run() would not return.
+    void prepare()
+    {
+        if (m_prepared) {
+            return;
+        }
+        if (!is_acyclic()) {
+            throw std::invalid_argument("cpputility::TaskGraph: the graph contains a cycle");
+        }
+        m_pendingDependencies = std::make_unique<std::atomic<size_t>[]>(m_tasks.size());
+        m_pendingChunks = std::make_unique<std::atomic<size_t>[]>(m_tasks.size());
+        m_prepared = true;
+    }
+
+    void reset()
+    {
+        for (size_t task = 0; task < m_tasks.size(); ++task) {
+            m_pendingDependencies[task].store(m_tasks[task].dependencies,
+                                              std::memory_order_relaxed);
+            m_pendingChunks[task].store(m_tasks[task].chunks, std::memory_order_relaxed);
+        }
+    }
+
+    bool is_acyclic() const
+    {
+        std::vector<size_t> dependencies(m_tasks.size());
+        std::vector<TaskId> ready;
+        for (size_t task = 0; task < m_tasks.size(); ++task) {
+            dependencies[task] = m_tasks[task].dependencies;
+            if (dependencies[task] == 0) {
+                ready.push_back(task);
+            }
+        }
+        size_t visited = 0;
+        while (!ready.empty()) {
+            auto const task = ready.back();
+            ready.pop_back();
+            ++visited;
+            for (auto successor : m_tasks[task].successors) {
+                if (--dependencies[successor] == 0) {
+                    ready.push_back(successor);
+                }
+            }
+        }
+        return visited == m_tasks.size();
+    }
+};
+
+/// Pool of persistent worker threads running TaskGraphs by work stealing.
+///
+/// Every thread owns a queue of (task, chunk) work items. It pushes and pops work at the back of
+/// its own queue, so the chunks and successors it just made ready are processed while their data
+/// is still in cache, and idle threads steal from the front of the other queues. The queues are
+/// guarded by one mutex each, which is only ever contended by a thief. The thread calling run()
+/// takes part in the work.
+class TaskScheduler
+{
+private:
+    struct WorkItem
+    {
+        TaskGraph::TaskId task;
+        size_t chunk;
+    };
+
+    class WorkQueue
+    {
+    private:
+        std::mutex m_mutex;
+        std::deque<WorkItem> m_items;
+
+    public:
+        void push(WorkItem item)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_items.push_back(item);
+        }
+
+        bool pop(WorkItem &item)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_items.empty()) {
+                return false;
+            }
+            item = m_items.back();
+            m_items.pop_back();
+            return true;
+        }
+
+        bool steal(WorkItem &item)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_items.empty()) {
+                return false;
+            }
+            item = m_items.front();
+            m_items.pop_front();
+            return true;
+        }
+    };
+
+    std::vector<std::unique_ptr<WorkQueue>> m_queues;
+    std::vector<std::thread> m_threads;
+    std::mutex m_runMutex;
+    std::mutex m_sleepMutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_done;
+    std::atomic<size_t> m_queued{0};
+    std::atomic<size_t> m_sleeping{0};
+    std::atomic<size_t> m_remainingTasks{0};
+    TaskGraph *m_graph = nullptr;
+    std::exception_ptr m_error;
+    std::atomic<bool> m_failed{false};
+    bool m_stop = false;
+
+public:
+    explicit TaskScheduler(size_t thread_count = hardware_thread_count())
+    {
+        auto const threads = std::max(thread_count, size_t{1});
+        for (size_t index = 0; index < threads; ++index) {
+            m_queues.push_back(std::make_unique<WorkQueue>());
+        }
+        for (size_t index = 1; index < threads; ++index) {
+            m_threads.emplace_back([this, index]() { worker_loop(index); });
+        }
+    }
+
+    TaskScheduler(TaskScheduler const &) = delete;
+
+    TaskScheduler &operator=(TaskScheduler const &) = delete;
+
+    ~TaskScheduler()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+            m_stop = true;
+        }
+        m_wake.notify_all();
+        for (auto &thread : m_threads) {
+            thread.join();
+        }
+    }
+
+    /// Number of threads including the one calling run().
+    inline size_t thread_count() const { return m_queues.size(); }
+
+    /// Runs all tasks of graph respecting their dependencies and returns once all finished. If
+    /// tasks throw, the remaining work items are skipped and the first exception is rethrown.
+    /// Throws std::invalid_argument without running anything if graph contains a cycle. Tasks
+    /// must not call run() themselves.
+    void run(TaskGraph &graph)
+    {
+        std::lock_guard<std::mutex> runLock(m_runMutex);
+        if (graph.empty()) {
+            return;
+        }
+
+        graph.prepare();
+        graph.reset();
+        m_graph = &graph;
+        m_error = nullptr;
+        m_failed.store(false, std::memory_order_relaxed);
+        m_remainingTasks.store(graph.size());
+
+        for (size_t task = 0; task < graph.size(); ++task) {
+            if (graph.m_tasks[task].dependencies == 0) {
+                schedule(0, task);
+            }
+        }
+
+        while (m_remainingTasks.load() != 0) {
+            WorkItem item;
+            if (find_work(0, item)) {
+                execute(0, item);
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            ++m_sleeping;
+            m_done.wait(lock, [this]() {
+                return m_remainingTasks.load() == 0 || m_queued.load() != 0;
+            });
+            --m_sleeping;
+        }
+
+        m_graph = nullptr;
+        if (m_error) {
+            std::rethrow_exception(m_error);
+        }
+    }
+
+private:
+    void worker_loop(size_t index)
+    {
+        while (true) {
+            WorkItem item;
+            if (find_work(index, item)) {
+                execute(index, item);
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            ++m_sleeping;
+            m_wake.wait(lock, [this]() { return m_stop || m_queued.load() != 0; });
+            --m_sleeping;
+            if (m_stop) {
+                return;
+            }
+        }
+    }
+
+    bool find_work(size_t index, WorkItem &item)
+    {
+        if (m_queues[index]->pop(item)) {
+            m_queued.fetch_sub(1);
+            return true;
+        }
+        for (size_t offset = 1; offset < m_queues.size(); ++offset) {
+            if (m_queues[(index + offset) % m_queues.size()]->steal(item)) {
+                m_queued.fetch_sub(1);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Pushes all chunks of task onto the queue of thread index and wakes idle threads.
+    void schedule(size_t index, TaskGraph::TaskId task)
+    {
+        auto const chunks = m_graph->m_tasks[task].chunks;
+        m_queued.fetch_add(chunks);
+        for (size_t chunk = chunks; chunk-- > 0;) {
+            m_queues[index]->push(WorkItem{task, chunk});
+        }
+        notify(chunks > 1);
+    }
+
+    /// Wakes sleeping threads after new work was queued or the last task finished. Sleepers
+    /// register before checking their wait condition and all involved counters are sequentially
+    /// consistent, so either a sleeper sees the change or the notifier sees the sleeper.
+    void notify(bool all)
+    {
+        if (m_sleeping.load() == 0) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+        }
+        if (all) {
+            m_wake.notify_all();
+        } else {
+            m_wake.notify_one();
+        }
+        m_done.notify_one();
+    }
+
+    void execute(size_t index, WorkItem const &item)
+    {
+        auto &graph = *m_graph;
+        auto const &task = graph.m_tasks[item.task];
+
+        if (!m_failed.load(std::memory_order_relaxed)) {
+            try {
+                CPPUTILITY_TRACE_SCOPE(task.name);
+                task.work(item.chunk);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(m_sleepMutex);
+                if (!m_error) {
+                    m_error = std::current_exception();
+                }
+                m_failed.store(true, std::memory_order_relaxed);
+            }
+        }
+
+        if (graph.m_pendingChunks[item.task].fetch_sub(1, std::memory_order_acq_rel) != 1) {
+            return;
+        }
+        for (auto successor : task.successors) {
+            if (graph.m_pendingDependencies[successor].fetch_sub(1, std::memory_order_acq_rel)
+                == 1) {
+                schedule(index, successor);
+            }
+        }
+        if (m_remainingTasks.fetch_sub(1) == 1) {
+            notify(false);
+        }
+    }
+};
+} // namespace cpputility
+
+#endif // CPPUTILITY_TASK_GRAPH_HPP
@@ -0,0 +1,329 @@
+/* NetSim Project - Numerical Simulation, Analysis and Optimization of District Heating Networks
+ *
+ * include/cpputility/trace.hpp
+ *
+ * created: 2026-10-19, Dominik Linn <d.linn@gmx.net> <dominik.linn@itwm.fraunhofer.de>
+ *
+ * (c) 2026 Dominik Linn, Fraunhofer ITWM
+ *
+ */
+
+#ifndef CPPUTILITY_TRACE_HPP
+#define CPPUTILITY_TRACE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+/// The CPPUTILITY_TRACE_* macros record events only if CPPUTILITY_TRACING is non-zero (CMake
+/// option CPPUTILITY_ENABLE_TRACING), otherwise they expand to nothing.
+#ifndef CPPUTILITY_TRACING
+#define CPPUTILITY_TRACING 0
+#endif
+
+namespace cpputility
+{
+using std::size_t;
+
+/// Number of events a thread buffer holds before overwriting its oldest events.
+constexpr size_t default_trace_buffer_capacity = 16384;
+
+struct TraceEvent
+{
+    /// Has to outlive the trace, usually a string literal.
+    char const *name = nullptr;
+    /// Nanoseconds since the start of the trace.
+    std::int64_t timestamp = 0;
+    /// Nanoseconds, for regions only.
+    std::int64_t duration = 0;
+    /// For counters only.
+    double value = 0;
+    bool counter = false;
+};
+
+/// Ring buffer of the events of one thread. Only the owning thread records, so recording is a
+/// plain store followed by a release store of the head and never blocks.
+class TraceBuffer
+{
+private:
+    std::unique_ptr<TraceEvent[]> m_events;
+    size_t m_capacity;
+    size_t m_id;
+    std::atomic<size_t> m_head{0};
+
+public:
+    /// Keeps the last capacity events, but at least one.
+    TraceBuffer(size_t id, size_t capacity)
+        : m_events{std::make_unique<TraceEvent[]>(std::max(capacity, size_t{1}))}
+        , m_capacity{std::max(capacity, size_t{1})}
+        , m_id{id}
+    {
+    }
+
+    inline size_t id() const { return m_id; }
+
+    inline void record(TraceEvent const &event)
+    {
+        auto const head = m_head.load(std::memory_order_relaxed);
+        m_events[head % m_capacity] = event;
+        m_head.store(head + 1, std::memory_order_release);
+    }
+
+    /// Number of events which were overwritten because the buffer was full.
+    size_t dropped() const
+    {
+        auto const head = m_head.load(std::memory_order_acquire);
+        return head > m_capacity ? head - m_capacity : 0;
+    }
+
+    /// Calls operation(event) for all retained events, oldest first. Events recorded concurrently
+    /// may be skipped, so read the buffers once the traced phase finished.
+    template<typename Operation>
+    void for_each(Operation operation) const
+    {
+        auto const head = m_head.load(std::memory_order_acquire);
+        for (auto index = head > m_capacity ? head - m_capacity : 0; index < head; ++index) {
+            operation(m_events[index % m_capacity]);
+        }
+    }
+
+    inline void clear() { m_head.store(0, std::memory_order_release); }
+};
+
+/// Owner of all thread buffers. A buffer is handed to a thread on its first event and returned
+/// when the thread exits, so the short-lived workers of parallel_invoke_n reuse a small set of
+/// buffers; each buffer shows up as one track in the trace viewer.
+class TraceRegistry
+{
+private:
+    std::mutex m_mutex;
+    std::vector<std::shared_ptr<TraceBuffer>> m_buffers;
+    std::vector<std::shared_ptr<TraceBuffer>> m_free;
+    std::chrono::steady_clock::time_point m_epoch = std::chrono::steady_clock::now();
+    std::atomic<bool> m_enabled{true};
+    size_t m_capacity = default_trace_buffer_capacity;
+
+public:
+    static TraceRegistry &instance()
+    {
+        static TraceRegistry registry;
+        return registry;
+    }
+
+    inline bool enabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+    /// Switches recording on or off at runtime, e.g. to trace selected timesteps only.
+    inline void set_enabled(bool enabled) { m_enabled.store(enabled, std::memory_order_relaxed); }
+
+    /// Capacity of buffers created from now on, 0 is raised to 1.
+    void set_buffer_capacity(size_t capacity)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_capacity = std::max(capacity, size_t{1});
+    }
+
+    inline std::int64_t now() const
+    {
+        auto const elapsed = std::chrono::steady_clock::now() - m_epoch;
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+    }
+
+    std::shared_ptr<TraceBuffer> acquire_buffer()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_free.empty()) {
+            auto buffer = std::move(m_free.back());
+            m_free.pop_back();
+            return buffer;
+        }
+        m_buffers.push_back(std::make_shared<TraceBuffer>(m_buffers.size(), m_capacity));
+        return m_buffers.back();
+    }
+
+    void release_buffer(std::shared_ptr<TraceBuffer> buffer)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_free.push_back(std::move(buffer));
+    }
+
+    /// Discards all recorded events.
+    void clear()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto &buffer : m_buffers) {
+            buffer->clear();
+        }
+    }
+
+    /// Writes all retained events in the Chrome trace event format, which chrome://tracing and
+    /// Perfetto open directly.
+    void write_chrome_trace(std::ostream &stream)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto const flags = stream.flags();
+        stream.setf(std::ios::fixed, std::ios::floatfield);
+        auto const precision = stream.precision(3);
+
+        char const *separator = "";
+        stream << "{\"traceEvents\":[";
+        for (auto const &buffer : m_buffers) {
+            auto const thread = buffer->id();
+            stream << separator << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+                   << thread << ",\"args\":{\"name\":\"thread " << thread << "\"}}";
+            separator = ",";
+            buffer->for_each([&stream, thread](TraceEvent const &event) {
+                stream << ",\n{\"name\":\"";
+                write_escaped(stream, event.name);
+                stream << "\",\"ph\":\"" << (event.counter ? 'C' : 'X')
+                       << "\",\"pid\":1,\"tid\":" << thread
+                       << ",\"ts\":" << static_cast<double>(event.timestamp) / 1000.0;
+                if (event.counter) {
+                    // JSON has no NaN or Infinity
+                    stream << ",\"args\":{\"value\":";
+                    if (std::isfinite(event.value)) {
+                        // all digits, e.g. small residuals, timestamps stay in microseconds
+                        stream.unsetf(std::ios::floatfield);
+                        stream.precision(std::numeric_limits<double>::max_digits10);
+                        stream << event.value;
+                        stream.setf(std::ios::fixed, std::ios::floatfield);
+                        stream.precision(3);
+                    } else {
+                        stream << "null";
+                    }
+                    stream << "}}";
+                } else {
+                    stream << ",\"dur\":" << static_cast<double>(event.duration) / 1000.0 << "}";
+                }
+            });
+        }
+        stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+        stream.precision(precision);
+        stream.flags(flags);
+    }
+
+private:
+    TraceRegistry() = default;
+
+    /// Writes text as the contents of a JSON string, control characters as \u00XX.
+    static void write_escaped(std::ostream &stream, char const *text)
+    {
+        constexpr char const *hexDigits = "0123456789abcdef";
+        for (; text != nullptr && *text != '\0'; ++text) {
+            auto const character = static_cast<unsigned char>(*text);
+            if (character < 0x20) {
+                stream << "\\u00" << hexDigits[character >> 4] << hexDigits[character & 0xf];
+                continue;
+            }
+            if (*text == '"' || *text == '\\') {
+                stream << '\\';
+            }
+            stream << *text;
+        }
+    }
+};
+
+namespace detail
+{
+/// Holds the buffer of the current thread and returns it to the registry on thread exit.
+class ThreadTraceBuffer
+{
+private:
+    std::shared_ptr<TraceBuffer> m_buffer;
+
+public:
+    ThreadTraceBuffer() : m_buffer{TraceRegistry::instance().acquire_buffer()} {}
+
+    ThreadTraceBuffer(ThreadTraceBuffer const &) = delete;
+
+    ThreadTraceBuffer &operator=(ThreadTraceBuffer const &) = delete;
+
+    ~ThreadTraceBuffer() { TraceRegistry::instance().release_buffer(std::move(m_buffer)); }
+
+    inline TraceBuffer &buffer() { return *m_buffer; }
+};
+
+inline TraceBuffer &thread_trace_buffer()
+{
+    thread_local ThreadTraceBuffer buffer;
+    return buffer.buffer();
+}
+} // namespace detail
+
+/// Records the time between construction and destruction as a region called name.
+///
+/// The thread buffer is taken at construction, so regions of threads running at the same time
+/// always end up on different tracks.
+class ScopedTraceRegion
+{
+private:
+    char const *m_name;
+    TraceBuffer *m_buffer = nullptr;
+    std::int64_t m_start = 0;
+
+public:
+    explicit ScopedTraceRegion(char const *name) : m_name{name}
+    {
+        auto &registry = TraceRegistry::instance();
+        if (registry.enabled()) {
+            m_buffer = &detail::thread_trace_buffer();
+            m_start = registry.now();
+        }
+    }
+
+    ScopedTraceRegion(ScopedTraceRegion const &) = delete;
+
+    ScopedTraceRegion &operator=(ScopedTraceRegion const &) = delete;
+
+    ~ScopedTraceRegion()
+    {
+        if (m_buffer != nullptr) {
+            TraceEvent event;
+            event.name = m_name;
+            event.timestamp = m_start;
+            event.duration = TraceRegistry::instance().now() - m_start;
+            m_buffer->record(event);
+        }
+    }
+};
+
+/// Records the current value of the counter called name.
+inline void trace_counter(char const *name, double value)
+{
+    auto &registry = TraceRegistry::instance();
+    if (registry.enabled()) {
+        TraceEvent event;
+        event.name = name;
+        event.timestamp = registry.now();
+        event.value = value;
+        event.counter = true;
+        detail::thread_trace_buffer().record(event);
+    }
+}
+
+inline void write_chrome_trace(std::ostream &stream)
+{
+    TraceRegistry::instance().write_chrome_trace(stream);
+}
+} // namespace cpputility
+
+#if CPPUTILITY_TRACING
+#define CPPUTILITY_TRACE_CONCAT_IMPL(lhs, rhs) lhs##rhs
+#define CPPUTILITY_TRACE_CONCAT(lhs, rhs) CPPUTILITY_TRACE_CONCAT_IMPL(lhs, rhs)
+#define CPPUTILITY_TRACE_SCOPE(name)                                                              \
+    ::cpputility::ScopedTraceRegion CPPUTILITY_TRACE_CONCAT(cpputilityTraceRegion, __LINE__)(name)
+#define CPPUTILITY_TRACE_COUNTER(name, value) ::cpputility::trace_counter(name, value)
+#else
+#define CPPUTILITY_TRACE_SCOPE(name) ((void) 0)
+#define CPPUTILITY_TRACE_COUNTER(name, value) ((void) 0)
+#endif
+
+#endif // CPPUTILITY_TRACE_HPP
@@ -0,0 +1,47 @@
+/* NetSim Project - Numerical Simulation, Analysis and Optimization of District Heating Networks
+ *
+ * tests/check.hpp
+ *
+ * created: 2026-10-19, Dominik Linn <d.linn@gmx.net> <dominik.linn@itwm.fraunhofer.de>
+ *
+ * (c) 2026 Dominik Linn, Fraunhofer ITWM
+ *
+ */
+
+#ifndef CPPUTILITY_TESTS_CHECK_HPP
+#define CPPUTILITY_TESTS_CHECK_HPP
+
+#include <iostream>
+
+namespace cpputility::test
+{
+inline int &failure_count()
+{
+    static int count = 0;
+    return count;
+}
+
+inline void check(bool condition, char const *expression, char const *file, int line)
+{
+    if (!condition) {
+        std::cerr << file << ":" << line << ": check failed: " << expression << std::endl;
+        ++failure_count();
+    }
+}
+
+/// Exit code of a test executable, non-zero if any check failed.
+inline int result()
+{
+    if (failure_count() != 0) {
+        std::cerr << failure_count() << " check(s) failed" << std::endl;
+        return 1;
+    }
+    return 0;
+}
+} // namespace cpputility::test
+
+/// Unlike assert, checks are evaluated in release builds as well and do not abort, so one run
+/// reports all failures.
+#define CHECK(condition) ::cpputility::test::check((condition), #condition, __FILE__, __LINE__)
+
+#endif // CPPUTILITY_TESTS_CHECK_HPP
@@ -0,0 +1,115 @@
+#include <cpputility/containers/compressed_history.hpp>
+#include <cpputility/containers/vector_view.hpp>
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "check.hpp"
+
+using namespace cpputility;
+
+namespace
+{
+template<typename T>
+bool bitwise_equal(std::vector<T> const &lhs, std::vector<T> const &rhs)
+{
+    return lhs.size() == rhs.size()
+           && (lhs.empty() || std::memcmp(lhs.data(), rhs.data(), lhs.size() * sizeof(T)) == 0);
+}
+
+/// Slowly changing rows mixed with random jumps and special values.
+template<typename T>
+std::vector<std::vector<T>> make_rows(ptrdiff_t timesteps, size_t width)
+{
+    std::mt19937 rng(5);
+    std::normal_distribution<T> noise(0, 1);
+    std::vector<std::vector<T>> rows;
+    std::vector<T> row(width);
+    for (size_t pos = 0; pos < width; ++pos) {
+        row[pos] = static_cast<T>(300 + pos);
+    }
+    for (ptrdiff_t step = 0; step < timesteps; ++step) {
+        for (size_t pos = 0; pos < width; ++pos) {
+            if (rng() % 4 == 0) {
+                row[pos] += static_cast<T>(0.01) * noise(rng);
+            } else if (rng() % 50 == 0) {
+                row[pos] = noise(rng) * static_cast<T>(1e30);
+            }
+        }
+        if (width >= 6) {
+            row[0] = std::numeric_limits<T>::quiet_NaN();
+            row[1] = std::numeric_limits<T>::infinity() * static_cast<T>(step % 2 ? 1 : -1);
+            row[2] = static_cast<T>(-0.0);
+            row[3] = std::numeric_limits<T>::denorm_min();
+            row[4] = std::numeric_limits<T>::max();
+            row[5] = std::numeric_limits<T>::lowest();
+        }
+        rows.push_back(row);
+    }
+    return rows;
+}
+
+template<typename T>
+void test_round_trip()
+{
+    for (ptrdiff_t blockLength : {1, 4, 16}) {
+        for (size_t width : {0ul, 1ul, 7ul, 300ul}) {
+            auto const rows = make_rows<T>(37, width);
+            CompressedHistory<T> history(static_cast<ptrdiff_t>(width), blockLength);
+            for (auto const &row : rows) {
+                history.append(row);
+            }
+            CHECK(history.timesteps() == 37);
+
+            std::vector<T> decoded(width);
+            bool matches = true;
+            // random access
+            for (ptrdiff_t step = 36; step >= 0; step -= 5) {
+                history.decode(step, decoded);
+                matches = matches && bitwise_equal(decoded, rows[static_cast<size_t>(step)]);
+            }
+            // streaming, into a view
+            VectorView<std::vector<T>> view(decoded);
+            history.for_each_timestep(3, 37, view, [&](ptrdiff_t step, auto const &) {
+                matches = matches && bitwise_equal(decoded, rows[static_cast<size_t>(step)]);
+            });
+            CHECK(matches);
+        }
+    }
+}
+
+void test_compression()
+{
+    std::vector<double> row(1000, 320.0);
+    CompressedHistory<double> history(1000);
+    for (int step = 0; step < 64; ++step) {
+        row[static_cast<size_t>(step)] += 1.0;
+        history.append(row);
+    }
+    history.shrink_to_fit();
+    // unchanged values cost a single bit
+    CHECK(history.compressed_bytes() * 10 < history.uncompressed_bytes());
+
+    std::vector<double> decoded(1000);
+    history.decode(63, decoded);
+    CHECK(decoded == row);
+
+    history.clear();
+    CHECK(history.empty());
+    row.assign(1000, 1.5);
+    history.append(row);
+    history.decode(0, decoded);
+    CHECK(decoded == row);
+}
+} // namespace
+
+int main(int, char **)
+{
+    test_round_trip<double>();
+    test_round_trip<float>();
+    test_compression();
+    return test::result();
+}
@@ -0,0 +1,132 @@
+#include <cpputility/containers/dirty_tracking_view.hpp>
+
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "check.hpp"
+
+using namespace cpputility;
+
+namespace
+{
+void test_block_tracking()
+{
+    std::vector<int> values(1000, 0);
+    DirtyTrackingView<std::vector<int>> view(values, 100);
+    CHECK(view.block_count() == 10);
+    CHECK(!view.has_dirty());
+
+    view[5] = 1;
+    view[250] = 2;
+    view[999] = 3;
+    CHECK(values[5] == 1 && values[250] == 2 && values[999] == 3);
+    CHECK(view.dirty_block_count() == 3);
+    CHECK(view.is_dirty_block(0) && view.is_dirty_block(2) && view.is_dirty_block(9));
+    CHECK(!view.is_dirty_block(1));
+
+    std::vector<std::pair<size_t, size_t>> blocks;
+    auto const collect = [&blocks](size_t begin, size_t end) { blocks.emplace_back(begin, end); };
+    view.for_each_dirty_block(collect);
+    CHECK((blocks == std::vector<std::pair<size_t, size_t>>{{0, 100}, {200, 300}, {900, 1000}}));
+
+    size_t elements = 0;
+    view.for_each_dirty([&elements](size_t) { ++elements; });
+    CHECK(elements == 300);
+
+    blocks.clear();
+    view.consume_dirty_blocks(collect);
+    CHECK(blocks.size() == 3);
+    CHECK(!view.has_dirty());
+}
+
+void test_set_only_marks_changes()
+{
+    std::vector<int> values(100, 7);
+    DirtyTrackingView<std::vector<int>> view(values, 10);
+    view.set(15, 7);
+    CHECK(!view.has_dirty());
+    view.set(15, 8);
+    CHECK(values[15] == 8);
+    CHECK(view.dirty_block_count() == 1 && view.is_dirty_block(1));
+
+    // reading through a const view is not recorded
+    view.clear_dirty();
+    auto const &constView = view;
+    int sum = 0;
+    for (ptrdiff_t pos = 0; pos < constView.size(); ++pos) {
+        sum += constView[pos];
+    }
+    CHECK(sum == 99 * 7 + 8);
+    CHECK(!view.has_dirty());
+
+    // writing through mutable iterators is
+    for (auto &value : view) {
+        value = 0;
+    }
+    CHECK(view.dirty_block_count() == 10);
+}
+
+void test_index_tracking()
+{
+    std::vector<double> values(300, 0.0);
+    DirtyTrackingView<std::vector<double>> view(values, 64, true);
+    view[200] = 1.0;
+    view[3] = 1.0;
+    view[200] = 2.0;
+    CHECK((view.dirty_indices() == std::vector<size_t>{200, 3}));
+
+    view.clear_dirty();
+    CHECK(view.dirty_indices().empty());
+
+    view.mark_all_dirty();
+    CHECK(view.dirty_indices().size() == 300);
+    CHECK(view.dirty_block_count() == view.block_count());
+}
+
+void test_resize()
+{
+    std::vector<int> values(10, 0);
+    DirtyTrackingView<std::vector<int>> view(values, 4, true);
+    view[9] = 1;
+
+    // writes beyond the previous size grow the tracking
+    values.resize(200, 0);
+    view[199] = 1;
+    view[150] = 1;
+    CHECK(view.is_dirty_block(2) && view.is_dirty_block(49) && view.is_dirty_block(37));
+    CHECK(view.dirty_block_count() == 3);
+    CHECK((view.dirty_indices() == std::vector<size_t>{9, 199, 150}));
+
+    // blocks beyond the end of the shrunk vector are skipped, the last one is cut
+    values.resize(151);
+    std::vector<std::pair<size_t, size_t>> blocks;
+    view.for_each_dirty_block(
+        [&blocks](size_t begin, size_t end) { blocks.emplace_back(begin, end); });
+    CHECK((blocks == std::vector<std::pair<size_t, size_t>>{{8, 12}, {148, 151}}));
+    CHECK(view.dirty_block_count() == 2 && !view.is_dirty_block(49));
+    size_t elements = 0;
+    view.for_each_dirty([&elements](size_t) { ++elements; });
+    CHECK(elements == 7);
+
+    values.resize(10);
+    view.clear_dirty();
+    view[9] = 2;
+    values.clear();
+    CHECK(!view.has_dirty() && view.dirty_block_count() == 0);
+}
+
+// copies would record writes to the same vector separately
+static_assert(!std::is_copy_constructible_v<DirtyTrackingView<std::vector<int>>>);
+static_assert(!std::is_copy_assignable_v<DirtyTrackingView<std::vector<int>>>);
+static_assert(std::is_move_constructible_v<DirtyTrackingView<std::vector<int>>>);
+} // namespace
+
+int main(int, char **)
+{
+    test_block_tracking();
+    test_set_only_marks_changes();
+    test_index_tracking();
+    test_resize();
+    return test::result();
+}
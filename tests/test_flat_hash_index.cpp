@@ -0,0 +1,222 @@
+#include <cpputility/containers/flat_hash_index.hpp>
+#include <cpputility/containers/indexed_storage_vector.hpp>
+#include <cpputility/memory.hpp>
+
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+#include "check.hpp"
+
+using namespace cpputility;
+
+namespace
+{
+/// Sends every key to the same home slot, so every operation has to probe.
+struct CollidingHash
+{
+    size_t operator()(int) const { return 0; }
+};
+
+template<typename IndexT>
+bool matches(IndexT const &index, std::unordered_map<int, int> const &reference)
+{
+    if (index.size() != reference.size()) {
+        return false;
+    }
+    for (auto const &[key, value] : reference) {
+        auto const *found = index.find(key);
+        if (found == nullptr || *found != value) {
+            return false;
+        }
+    }
+    size_t visited = 0;
+    bool consistent = true;
+    index.for_each([&](int key, int value) {
+        ++visited;
+        consistent = consistent && reference.count(key) == 1 && reference.at(key) == value;
+    });
+    return consistent && visited == reference.size();
+}
+
+template<typename IndexT>
+void test_against_unordered_map(int keyRange, int operations)
+{
+    IndexT index;
+    std::unordered_map<int, int> reference;
+    std::mt19937 rng(3);
+    bool insertsAgree = true;
+    bool erasesAgree = true;
+    for (int step = 0; step < operations; ++step) {
+        auto const key = static_cast<int>(rng() % static_cast<unsigned>(keyRange));
+        if (rng() % 3 != 0) {
+            auto const inserted = index.insert(key, step);
+            insertsAgree = insertsAgree && inserted == reference.emplace(key, step).second;
+        } else {
+            erasesAgree = erasesAgree && index.erase(key) == (reference.erase(key) == 1);
+        }
+    }
+    CHECK(insertsAgree);
+    CHECK(erasesAgree);
+    CHECK(matches(index, reference));
+    CHECK(!index.contains(keyRange));
+}
+
+void test_basic_operations()
+{
+    FlatHashIndex<int, int> index;
+    CHECK(index.empty() && index.find(1) == nullptr && !index.erase(1));
+
+    CHECK(index.insert(1, 10));
+    CHECK(!index.insert(1, 11));
+    CHECK(*index.find(1) == 10);
+    *index.find(1) = 12;
+    CHECK(index.contains(1) && *index.find(1) == 12);
+
+    // growing keeps all entries
+    for (int key = 2; key < 1000; ++key) {
+        index.insert(key, key * 10);
+    }
+    CHECK(index.size() == 999 && index.capacity() >= 999);
+    CHECK(*index.find(999) == 9990);
+
+    index.clear();
+    CHECK(index.empty() && !index.contains(999));
+    index.reserve(5000);
+    auto const capacity = index.capacity();
+    for (int key = 0; key < 5000; ++key) {
+        index.insert(key, key);
+    }
+    CHECK(index.capacity() == capacity);
+
+    FlatHashIndex<std::string, int> strings(4);
+    strings.insert("supply", 1);
+    strings.insert("return", 2);
+    CHECK(*strings.find("return") == 2 && !strings.contains("bypass"));
+}
+
+struct Pipe
+{
+    int id;
+    std::string name;
+
+    int get_id() const { return id; }
+};
+
+void test_indexed_storage_vector()
+{
+    auto pipes = make_indexed_storage_vector<Pipe>(
+        &Pipe::id, [](Pipe const &pipe) { return pipe.name; }, &Pipe::get_id);
+    for (int id = 0; id < 100; ++id) {
+        pipes.emplace_back(std::make_unique<Pipe>(Pipe{id, "p" + std::to_string(id)}));
+    }
+    CHECK(pipes.size() == 100);
+    CHECK(pipes.find(42) == &pipes[42]);
+    CHECK(pipes.find<1>("p7") == &pipes[7]);
+    CHECK(pipes.find<2>(99) == &pipes[99]);
+    CHECK(pipes.find(100) == nullptr && !pipes.contains<1>("p100"));
+
+    // elements keep their address, so the indexes stay valid when inserting in the middle
+    auto *const pipe42 = &pipes[42];
+    pipes.emplace(pipes.begin() + 10, std::make_unique<Pipe>(Pipe{1000, "inserted"}));
+    CHECK(pipes[10].id == 1000 && pipes.find<1>("inserted") == &pipes[10]);
+    CHECK(pipes.find(42) == pipe42 && &pipes[43] == pipe42);
+
+    pipes.erase(pipes.begin() + 43);
+    CHECK(pipes.size() == 100);
+    CHECK(!pipes.contains(42) && !pipes.contains<1>("p42") && !pipes.contains<2>(42));
+    CHECK(pipes.find(43) == &pipes[43]);
+
+    for (auto &pipe : pipes) {
+        pipe.id += 5000;
+    }
+    pipes.rebuild_indexes();
+    CHECK(!pipes.contains(0) && pipes.find(5000) == &pipes[0]);
+    CHECK(pipes.find<2>(6000) == &pipes[10]);
+
+    pipes.clear();
+    CHECK(pipes.size() == 0 && !pipes.contains(5000));
+}
+
+void test_duplicate_keys()
+{
+    auto pipes = make_indexed_storage_vector<Pipe>(
+        &Pipe::id, [](Pipe const &pipe) { return pipe.name; });
+    pipes.emplace_back(std::make_unique<Pipe>(Pipe{1, "supply"}));
+    pipes.emplace_back(std::make_unique<Pipe>(Pipe{2, "return"}));
+
+    // the id is new, the name is not
+    auto duplicate = std::make_unique<Pipe>(Pipe{3, "return"});
+    bool thrown = false;
+    try {
+        pipes.emplace_back(std::move(duplicate));
+    } catch (std::invalid_argument const &) {
+        thrown = true;
+    }
+    CHECK(thrown);
+    CHECK(duplicate != nullptr);
+    CHECK(pipes.size() == 2 && !pipes.contains(3));
+
+    thrown = false;
+    try {
+        pipes.emplace(pipes.begin(), std::make_unique<Pipe>(Pipe{1, "bypass"}));
+    } catch (std::invalid_argument const &) {
+        thrown = true;
+    }
+    CHECK(thrown);
+    CHECK(pipes.size() == 2 && !pipes.contains<1>("bypass"));
+
+    // erasing the present element still finds the right entries
+    pipes.erase(pipes.begin() + 1);
+    CHECK(pipes.find(1) == &pipes[0] && pipes.find<1>("supply") == &pipes[0]);
+    CHECK(!pipes.contains(2) && !pipes.contains<1>("return"));
+
+    pipes.emplace_back(std::make_unique<Pipe>(Pipe{2, "return"}));
+    pipes[1].id = 1;
+    thrown = false;
+    try {
+        pipes.rebuild_indexes();
+    } catch (std::invalid_argument const &) {
+        thrown = true;
+    }
+    CHECK(thrown);
+    // the previous indexes are kept
+    CHECK(pipes.find(2) == &pipes[1] && pipes.find(1) == &pipes[0]);
+}
+
+void test_allocator()
+{
+    CountingMemoryResource resource;
+    pmr::FlatHashIndex<int, int> index(&resource);
+    for (int key = 0; key < 1000; ++key) {
+        index.insert(key, key);
+    }
+    CHECK(index.get_allocator().resource() == &resource);
+    CHECK(resource.statistics().bytes_in_use >= index.capacity() * 2 * sizeof(int));
+
+    CountingMemoryResource storageResource;
+    IndexedStorageVector<pmr::StorageVector<Pipe>, decltype(&Pipe::id)> pipes(
+        pmr::StorageVector<Pipe>(&storageResource), &Pipe::id);
+    pipes.emplace_back(make_unique_pmr<Pipe>(&storageResource, Pipe{1, "supply"}));
+    auto const beforeIndex = storageResource.statistics().allocations;
+    pipes.reserve(100);
+    // the pointer array and the index grow in the resource of the storage
+    CHECK(storageResource.statistics().allocations >= beforeIndex + 2);
+    CHECK(pipes.find(1) == &pipes[0]);
+}
+} // namespace
+
+int main(int, char **)
+{
+    test_basic_operations();
+    test_against_unordered_map<FlatHashIndex<int, int>>(5000, 50000);
+    // few keys in a small table, so erase has to shift back entries of long probe runs
+    test_against_unordered_map<FlatHashIndex<int, int>>(40, 5000);
+    test_against_unordered_map<FlatHashIndex<int, int, CollidingHash>>(100, 5000);
+    test_indexed_storage_vector();
+    test_duplicate_keys();
+    test_allocator();
+    return test::result();
+}
@@ -0,0 +1,137 @@
+#include <cpputility/containers/hierarchical_bitset.hpp>
+#include <cpputility/containers/masked_view.hpp>
+#include <cpputility/memory.hpp>
+
+#include <numeric>
+#include <vector>
+
+#include "check.hpp"
+
+using namespace cpputility;
+
+namespace
+{
+std::vector<size_t> set_bits(HierarchicalBitset const &bitset)
+{
+    std::vector<size_t> result;
+    bitset.for_each([&result](size_t pos) { result.push_back(pos); });
+    return result;
+}
+
+void test_bitset()
+{
+    // two summary words, so for_each has to skip empty summary words
+    HierarchicalBitset bitset(5000);
+    CHECK(!bitset.any() && bitset.count() == 0);
+
+    bitset.set(0);
+    bitset.set(63);
+    bitset.set(4999);
+    bitset.set(4200, true);
+    CHECK(bitset.test(63) && !bitset.test(64));
+    CHECK(bitset.count() == 4);
+    CHECK((set_bits(bitset) == std::vector<size_t>{0, 63, 4200, 4999}));
+
+    bitset.reset(4200);
+    bitset.set(63, false);
+    CHECK((set_bits(bitset) == std::vector<size_t>{0, 4999}));
+
+    bitset.set_range(60, 200);
+    CHECK(bitset.count() == 2 + 140);
+    bitset.reset_all();
+    CHECK(!bitset.any());
+
+    bitset.set_all();
+    CHECK(bitset.count() == 5000);
+
+    // shrinking clears the bits beyond the new size
+    bitset.resize(70);
+    CHECK(bitset.count() == 70);
+    bitset.resize(200);
+    CHECK(bitset.count() == 70);
+    CHECK(!bitset.test(150));
+}
+
+void test_bitset_operations()
+{
+    HierarchicalBitset lhs(300);
+    HierarchicalBitset rhs(300);
+    lhs.set_range(0, 100);
+    rhs.set_range(50, 250);
+
+    CHECK((lhs & rhs).count() == 50);
+    CHECK((lhs | rhs).count() == 250);
+    CHECK(and_not(lhs, rhs).count() == 50);
+    CHECK(set_bits(and_not(rhs, lhs)).front() == 100);
+
+    // the summary follows words that become zero
+    lhs &= HierarchicalBitset(300);
+    CHECK(!lhs.any());
+    CHECK(set_bits(lhs).empty());
+}
+
+void test_bitset_allocator()
+{
+    CountingMemoryResource resource;
+    {
+        pmr::HierarchicalBitset lhs(5000, &resource);
+        pmr::HierarchicalBitset rhs(5000, &resource);
+        CHECK(lhs.get_allocator().resource() == &resource);
+        // element and summary level of both
+        CHECK(resource.statistics().allocations == 4);
+        lhs.set_range(100, 300);
+        rhs.set(200);
+        CHECK((lhs & rhs).count() == 1);
+        CHECK(and_not(lhs, rhs).count() == 199);
+    }
+    CHECK(resource.statistics().bytes_in_use == 0);
+}
+
+void test_masked_view()
+{
+    std::vector<int> values(1000);
+    std::iota(values.begin(), values.end(), 0);
+    auto view = masked_view(values);
+    CHECK(view.active_count() == 0);
+
+    view.assign_if([](int value) { return value % 10 == 0; });
+    CHECK(view.active_count() == 100);
+    CHECK(view.is_active(990) && !view.is_active(991));
+
+    int sum = 0;
+    view.for_each([&sum](int value) { sum += value; });
+    CHECK(sum == 10 * (99 * 100 / 2));
+
+    view.for_each([](int &value) { value = -1; });
+    CHECK(values[20] == -1 && values[21] == 21);
+
+    view.deactivate(0);
+    view.activate(1);
+    std::vector<ptrdiff_t> positions;
+    view.for_each_indexed([&positions](ptrdiff_t pos, int) { positions.push_back(pos); });
+    CHECK(positions.size() == 100 && positions.front() == 1 && positions[1] == 10);
+
+    HierarchicalBitset lowHalf(1000);
+    lowHalf.set_range(0, 500);
+    view &= lowHalf;
+    CHECK(view.active_count() == 50);
+    view.and_not(lowHalf);
+    CHECK(view.active_count() == 0);
+    view |= lowHalf;
+    CHECK(view.active_count() == 500);
+
+    view.activate_all();
+    CHECK(view.active_count() == 1000);
+    view.deactivate_all();
+    CHECK(view.active_count() == 0);
+}
+} // namespace
+
+int main(int, char **)
+{
+    test_bitset();
+    test_bitset_operations();
+    test_bitset_allocator();
+    test_masked_view();
+    return test::result();
+}
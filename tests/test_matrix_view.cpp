@@ -0,0 +1,132 @@
+#include <cpputility/containers/matrix_view.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "check.hpp"
+
+using namespace cpputility;
+
+namespace
+{
+void test_access()
+{
+    std::vector<int> values(12);
+    std::iota(values.begin(), values.end(), 0);
+    auto matrix = matrix_view(values, 3, 4);
+    CHECK(matrix.rows() == 3 && matrix.cols() == 4 && matrix.row_stride() == 4);
+    CHECK(matrix(1, 2) == 6);
+    matrix(2, 3) = 100;
+    CHECK(values[11] == 100);
+
+    auto const row = matrix.row(1);
+    CHECK(row.size() == 4);
+    CHECK(row[0] == 4 && row[3] == 7);
+
+    auto const col = matrix.col(2);
+    CHECK(col.size() == 3);
+    CHECK(col[0] == 2 && col[1] == 6 && col[2] == 10);
+
+    auto tile = matrix.tile(1, 2, 2, 2);
+    CHECK(tile.rows() == 2 && tile.cols() == 2 && tile.row_stride() == 4);
+    CHECK(tile(0, 0) == 6 && tile(1, 1) == 100);
+    CHECK(tile.col(1)[1] == 100);
+}
+
+void test_for_each_tile()
+{
+    std::vector<int> values(7 * 5, 0);
+    auto matrix = matrix_view(values, 7, 5);
+
+    int tiles = 0;
+    matrix.for_each_tile(3, 2, [&tiles](auto tile, ptrdiff_t, ptrdiff_t) {
+        ++tiles;
+        for (ptrdiff_t r = 0; r < tile.rows(); ++r) {
+            for (ptrdiff_t c = 0; c < tile.cols(); ++c) {
+                ++tile(r, c);
+            }
+        }
+    });
+    CHECK(tiles == 3 * 3);
+    // every element belongs to exactly one tile
+    CHECK(std::all_of(values.begin(), values.end(), [](int value) { return value == 1; }));
+
+    // a few tiles are not worth a thread
+    auto const caller = std::this_thread::get_id();
+    bool onCaller = true;
+    matrix.parallel_for_each_tile(
+        3,
+        2,
+        [&onCaller, caller](auto tile, ptrdiff_t row, ptrdiff_t col) {
+            onCaller = onCaller && std::this_thread::get_id() == caller;
+            for (ptrdiff_t r = 0; r < tile.rows(); ++r) {
+                for (ptrdiff_t c = 0; c < tile.cols(); ++c) {
+                    tile(r, c) = static_cast<int>((row + r) * 5 + col + c);
+                }
+            }
+        },
+        4);
+    std::vector<int> expected(values.size());
+    std::iota(expected.begin(), expected.end(), 0);
+    CHECK(values == expected);
+    CHECK(onCaller);
+
+    std::vector<int> large(300 * 100, 0);
+    matrix_view(large, 300, 100).parallel_for_each_tile(
+        8,
+        8,
+        [](auto tile, ptrdiff_t row, ptrdiff_t col) {
+            for (ptrdiff_t r = 0; r < tile.rows(); ++r) {
+                for (ptrdiff_t c = 0; c < tile.cols(); ++c) {
+                    tile(r, c) = static_cast<int>((row + r) * 100 + col + c);
+                }
+            }
+        },
+        4);
+    expected.resize(large.size());
+    std::iota(expected.begin(), expected.end(), 0);
+    CHECK(large == expected);
+}
+
+void test_copy_and_transpose()
+{
+    for (auto const &[rows, cols] : {std::pair<ptrdiff_t, ptrdiff_t>{1, 1}, {5, 3}, {130, 70}}) {
+        std::vector<double> source(static_cast<size_t>(rows * cols));
+        std::iota(source.begin(), source.end(), 0.0);
+        auto const sourceView = matrix_view(source, rows, cols);
+
+        std::vector<double> copy(source.size());
+        tiled_copy(sourceView, matrix_view(copy, rows, cols), 16, 4);
+        CHECK(copy == source);
+
+        std::vector<double> transposed(source.size());
+        auto const transposedView = matrix_view(transposed, cols, rows);
+        tiled_transpose(sourceView, transposedView, 16, 4);
+        bool matches = true;
+        for (ptrdiff_t row = 0; row < rows; ++row) {
+            for (ptrdiff_t col = 0; col < cols; ++col) {
+                matches = matches && transposedView(col, row) == sourceView(row, col);
+            }
+        }
+        CHECK(matches);
+    }
+
+    // a tile of a larger matrix as destination leaves the rest untouched
+    std::vector<int> source{1, 2, 3, 4};
+    std::vector<int> destination(16, 0);
+    tiled_transpose(matrix_view(source, 2, 2), matrix_view(destination, 4, 4).tile(1, 1, 2, 2));
+    CHECK((destination
+           == std::vector<int>{0, 0, 0, 0, 0, 1, 3, 0, 0, 2, 4, 0, 0, 0, 0, 0}));
+}
+} // namespace
+
+int main(int, char **)
+{
+    test_access();
+    test_for_each_tile();
+    test_copy_and_transpose();
+    return test::result();
+}
@@ -0,0 +1,157 @@
+#include <cpputility/containers/reference_vector.hpp>
+#include <cpputility/containers/ring_buffer.hpp>
+#include <cpputility/containers/sparse_vector.hpp>
+#include <cpputility/containers/storage_vector.hpp>
+#include <cpputility/memory.hpp>
+
+#include <atomic>
+#include <functional>
+#include <memory_resource>
+
+#include "check.hpp"
+
+using namespace cpputility;
+
+namespace
+{
+struct Base
+{
+    virtual ~Base() = default;
+
+    virtual int kind() const { return 1; }
+};
+
+struct Padding
+{
+    virtual ~Padding() = default;
+
+    double values[3]{};
+};
+
+/// Larger than Base and with Base not at offset zero.
+struct Derived : Padding, Base
+{
+    int kind() const override { return 2; }
+
+    double more[8]{};
+};
+
+void test_counting_resource()
+{
+    CountingMemoryResource resource;
+    {
+        std::pmr::vector<double> values(&resource);
+        values.resize(100);
+        auto const statistics = resource.statistics();
+        CHECK(statistics.bytes_in_use == 100 * sizeof(double));
+        CHECK(statistics.allocations == 1);
+        values.resize(1000);
+        CHECK(resource.statistics().peak_bytes >= 1100 * sizeof(double));
+    }
+    auto const statistics = resource.statistics();
+    CHECK(statistics.bytes_in_use == 0);
+    CHECK(statistics.allocations == statistics.deallocations);
+    CHECK(statistics.total_bytes == 1100 * sizeof(double));
+
+    resource.reset_peak();
+    CHECK(resource.statistics().peak_bytes == 0);
+}
+
+void test_make_unique_pmr()
+{
+    CountingMemoryResource resource;
+    {
+        auto value = make_unique_pmr<double>(&resource, 2.5);
+        CHECK(*value == 2.5);
+        CHECK(value.get_deleter().resource() == &resource);
+        CHECK(resource.statistics().bytes_in_use == sizeof(double));
+
+        // a derived object converts to a pointer to its base and is released with its real size
+        pmr_unique_ptr<Base> base = make_unique_pmr<Derived>(&resource);
+        CHECK(base->kind() == 2);
+        CHECK(resource.statistics().bytes_in_use == sizeof(double) + sizeof(Derived));
+    }
+    CHECK(resource.statistics().bytes_in_use == 0);
+    CHECK(resource.statistics().deallocations == 2);
+}
+
+void test_pmr_storage_vector()
+{
+    CountingMemoryResource resource;
+    {
+        pmr::StorageVector<Base> storage{std::pmr::polymorphic_allocator<pmr_unique_ptr<Base>>(
+            &resource)};
+        storage.emplace_back(make_unique_pmr<Derived>(&resource));
+        storage.emplace_back(make_unique_pmr<Base>(&resource));
+        CHECK(storage.size() == 2);
+        CHECK(storage[0].kind() == 2 && storage[1].kind() == 1);
+        CHECK(resource.statistics().bytes_in_use >= sizeof(Derived) + sizeof(Base));
+
+        pmr::StorageVector<double> values{
+            std::pmr::polymorphic_allocator<pmr_unique_ptr<double>>(&resource)};
+        values.emplace_back(make_unique_pmr<double>(&resource, 1.0));
+        values.emplace_back(make_unique_pmr<double>(&resource, 2.0));
+        auto const allocations = resource.statistics().allocations;
+        auto const copy = values.clone();
+        CHECK(copy.size() == 2 && copy[1] == 2.0);
+        CHECK(copy.get_allocator().resource() == &resource);
+        // pointer array and both objects
+        CHECK(resource.statistics().allocations == allocations + 3);
+    }
+    CHECK(resource.statistics().bytes_in_use == 0);
+}
+
+void test_pmr_containers()
+{
+    CountingMemoryResource resource;
+    {
+        int a = 1;
+        int b = 2;
+        pmr::ReferenceVector<int> references{
+            std::pmr::polymorphic_allocator<std::reference_wrapper<int>>(&resource)};
+        references.emplace_back(a);
+        references.emplace_back(b);
+        CHECK(references.get_back() == 2);
+        CHECK(resource.statistics().allocations > 0);
+
+        pmr::SparseVector<double> sparse(10, std::pmr::polymorphic_allocator<double>(&resource));
+        sparse.set(3, 1.0);
+        CHECK(sparse.get_allocator().resource() == &resource);
+        CHECK(sparse[3] == 1.0);
+
+        auto const beforeBuffers = resource.statistics().bytes_in_use;
+        pmr::SpscRingBuffer<double> spsc(64, std::pmr::polymorphic_allocator<double>(&resource));
+        CHECK(spsc.get_allocator().resource() == &resource);
+        CHECK(resource.statistics().bytes_in_use == beforeBuffers + 64 * sizeof(double));
+        // slots and their sequence numbers
+        pmr::MpscRingBuffer<double> mpsc(64, std::pmr::polymorphic_allocator<double>(&resource));
+        CHECK(resource.statistics().bytes_in_use
+              == beforeBuffers + 2 * 64 * sizeof(double) + 64 * sizeof(std::atomic<size_t>));
+        auto region = mpsc.claim(2);
+        region[0] = 1.0;
+        region[1] = 2.0;
+        mpsc.commit(region);
+        CHECK(mpsc.peek().size() == 2 && mpsc.peek()[1] == 2.0);
+    }
+    CHECK(resource.statistics().bytes_in_use == 0);
+
+    // copy assignment to a shorter vector
+    int a = 1;
+    int b = 2;
+    ReferenceVector<int> longer;
+    longer.emplace_back(a);
+    longer.emplace_back(b);
+    ReferenceVector<int> shorter;
+    shorter = longer;
+    CHECK(shorter.size() == 2 && &shorter[1] == &b);
+}
+} // namespace
+
+int main(int, char **)
+{
+    test_counting_resource();
+    test_make_unique_pmr();
+    test_pmr_storage_vector();
+    test_pmr_containers();
+    return test::result();
+}
@@ -0,0 +1,66 @@
+#include <cpputility/containers/reference_vector.hpp>
+#include <cpputility/containers/storage_vector.hpp>
+#include <cpputility/prefetch.hpp>
+
+#include <memory>
+#include <vector>
+
+#include "check.hpp"
+
+using namespace cpputility;
+
+namespace
+{
+void test_visits_all_in_order()
+{
+    StorageVector<int> storage;
+    for (int value = 0; value < 1000; ++value) {
+        storage.emplace_back(std::make_unique<int>(value));
+    }
+
+    // distances and batch sizes smaller, larger and not dividing the size
+    for (size_t distance : {0ul, 1ul, 16ul, 5000ul}) {
+        for (size_t batchSize : {0ul, 1ul, 3ul, 8ul, 5000ul}) {
+            std::vector<int> visited;
+            for_each_batched(
+                storage, [&visited](int value) { visited.push_back(value); }, distance, batchSize);
+            bool ordered = visited.size() == 1000;
+            for (size_t pos = 0; ordered && pos < visited.size(); ++pos) {
+                ordered = visited[pos] == static_cast<int>(pos);
+            }
+            CHECK(ordered);
+        }
+    }
+
+    for_each_batched(storage, [](int &value) { value *= 2; });
+    CHECK(storage[999] == 1998);
+}
+
+void test_reference_vector_and_empty()
+{
+    std::vector<double> values(100, 1.0);
+    ReferenceVector<double> references;
+    for (auto &value : values) {
+        references.emplace_back(value);
+    }
+    double sum = 0;
+    for_each_batched(references, [&sum](double value) { sum += value; });
+    CHECK(sum == 100.0);
+
+    ReferenceVector<double> empty;
+    int calls = 0;
+    for_each_batched(empty, [&calls](double) { ++calls; });
+    CHECK(calls == 0);
+
+    int value = 0;
+    prefetch(&value);
+    prefetch(nullptr);
+}
+} // namespace
+
+int main(int, char **)
+{
+    test_visits_all_in_order();
+    test_reference_vector_and_empty();
+    return test::result();
+}
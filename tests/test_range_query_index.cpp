@@ -0,0 +1,123 @@
+#include <cpputility/containers/range_query_index.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "check.hpp"
+
+using namespace cpputility;
+
+namespace
+{
+/// Compares random range queries of all three indexes of values with a scan.
+struct BruteForce
+{
+    std::vector<long> &values;
+    std::mt19937 &rng;
+
+    template<class SumIndex, class MinIndex, class MaxIndex>
+    bool matches(SumIndex const &sum, MinIndex const &min, MaxIndex const &max) const
+    {
+        auto const size = values.size();
+        bool result = true;
+        for (int query = 0; query < 100; ++query) {
+            auto begin = rng() % (size + 1);
+            auto end = rng() % (size + 1);
+            if (begin > end) {
+                std::swap(begin, end);
+            }
+            long expectedSum = 0;
+            auto expectedMin = RangeMin<long>::identity();
+            auto expectedMax = RangeMax<long>::identity();
+            for (auto pos = begin; pos < end; ++pos) {
+                expectedSum += values[pos];
+                expectedMin = std::min(expectedMin, values[pos]);
+                expectedMax = std::max(expectedMax, values[pos]);
+            }
+            auto const first = static_cast<ptrdiff_t>(begin);
+            auto const last = static_cast<ptrdiff_t>(end);
+            result = result && sum.query(first, last) == expectedSum
+                     && min.query(first, last) == expectedMin
+                     && max.query(first, last) == expectedMax;
+        }
+        long total = 0;
+        for (auto const value : values) {
+            total += value;
+        }
+        return result && sum.total() == total;
+    }
+};
+
+void test_against_brute_force()
+{
+    std::mt19937 rng(1);
+    // sizes around powers of two, and large enough to build several subtrees concurrently
+    for (size_t size : {1ul, 2ul, 3ul, 7ul, 64ul, 100ul, 5000ul, 70000ul}) {
+        std::vector<long> values(size);
+        for (auto &value : values) {
+            value = static_cast<long>(rng() % 1000) - 500;
+        }
+        BruteForce brute{values, rng};
+
+        RangeSumIndex<std::vector<long>> sum(values, 4);
+        RangeMinIndex<std::vector<long>> min(VectorView<std::vector<long>>(values), 1);
+        RangeMaxIndex<std::vector<long>> max(values, 3);
+        CHECK(sum.size() == static_cast<ptrdiff_t>(size));
+        CHECK(brute.matches(sum, min, max));
+
+        // set_batch through one index, the others reread the same positions
+        std::vector<std::pair<ptrdiff_t, long>> updates;
+        std::vector<size_t> positions;
+        for (int update = 0; update < 50; ++update) {
+            auto const pos = static_cast<ptrdiff_t>(rng() % size);
+            updates.emplace_back(pos, static_cast<long>(rng() % 1000) - 500);
+            positions.push_back(static_cast<size_t>(pos));
+        }
+        sum.set_batch(updates);
+        min.refresh_batch(positions);
+        max.refresh_batch(positions);
+        CHECK(brute.matches(sum, min, max));
+
+        auto const last = static_cast<ptrdiff_t>(size) - 1;
+        sum.set(last, 10000);
+        min.refresh(last);
+        max.refresh(last);
+        CHECK(brute.matches(sum, min, max));
+
+        // arbitrary changes, also of the size, are picked up by rebuild on any thread count
+        values[0] = -10000;
+        values.resize(size + size / 3 + 1, 7);
+        sum.rebuild(2);
+        min.rebuild(16);
+        max.rebuild(1);
+        CHECK(brute.matches(sum, min, max));
+    }
+}
+
+void test_empty_ranges()
+{
+    std::vector<double> values{3.0, -1.0, 2.0};
+    RangeMinIndex<std::vector<double>> min(values);
+    RangeMaxIndex<std::vector<double>> max(values);
+    CHECK(std::isinf(min.query(1, 1)) && min.query(1, 1) > 0);
+    CHECK(std::isinf(max.query(0, 0)) && max.query(0, 0) < 0);
+    CHECK(min.total() == -1.0 && max.total() == 3.0);
+
+    std::vector<int> integers;
+    RangeSumIndex<std::vector<int>> sum(integers);
+    CHECK(sum.total() == 0 && sum.query(0, 0) == 0);
+    integers.assign(10, 1);
+    sum.rebuild();
+    CHECK(sum.query(2, 9) == 7);
+}
+} // namespace
+
+int main(int, char **)
+{
+    test_against_brute_force();
+    test_empty_ranges();
+    return test::result();
+}
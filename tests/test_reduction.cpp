@@ -0,0 +1,117 @@
+#include <cpputility/reduction.hpp>
+
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "check.hpp"
+
+using namespace cpputility;
+
+namespace
+{
+bool bitwise_equal(double lhs, double rhs)
+{
+    return std::memcmp(&lhs, &rhs, sizeof(double)) == 0;
+}
+
+std::vector<double> random_values(size_t size)
+{
+    std::mt19937_64 rng(11);
+    std::uniform_real_distribution<double> exponent(-8.0, 8.0);
+    std::vector<double> values(size);
+    for (auto &value : values) {
+        value = (rng() % 2 == 0 ? 1.0 : -1.0) * std::pow(10.0, exponent(rng));
+    }
+    return values;
+}
+
+void test_thread_count_independence()
+{
+    // several leaves, so the leaves are distributed differently for every thread count
+    for (size_t size : {0ul, 1ul, 2047ul, 2048ul, 100000ul}) {
+        auto const values = random_values(size);
+        auto other = random_values(size + 1);
+        other.erase(other.begin());
+
+        auto const sum = deterministic_sum(values, 1);
+        auto const dot = deterministic_dot(values, other, 1);
+        auto const norm = deterministic_norm(values, 1);
+        auto const compensated = compensated_sum(values, 1);
+        for (size_t threads : {2ul, 3ul, 4ul, 7ul, 16ul}) {
+            CHECK(bitwise_equal(deterministic_sum(values, threads), sum));
+            CHECK(bitwise_equal(deterministic_dot(values, other, threads), dot));
+            CHECK(bitwise_equal(deterministic_norm(values, threads), norm));
+            CHECK(bitwise_equal(compensated_sum(values, threads), compensated));
+        }
+    }
+
+    std::vector<long> integers(50000);
+    for (size_t index = 0; index < integers.size(); ++index) {
+        integers[index] = static_cast<long>(index);
+    }
+    auto const maximum = deterministic_reduce(
+        integers.size(),
+        0l,
+        [&integers](size_t index) { return integers[index] % 1000; },
+        [](long lhs, long rhs) { return std::max(lhs, rhs); },
+        4);
+    CHECK(maximum == 999);
+
+    // a few leaves are not worth a thread
+    auto const caller = std::this_thread::get_id();
+    bool onCaller = true;
+    deterministic_reduce(
+        default_min_block_size,
+        0l,
+        [&onCaller, caller](size_t index) {
+            onCaller = onCaller && std::this_thread::get_id() == caller;
+            return static_cast<long>(index);
+        },
+        [](long lhs, long rhs) { return lhs + rhs; },
+        16);
+    CHECK(onCaller);
+}
+
+void test_compensation()
+{
+    // 1 + n * 1e-16 is lost entirely by naive summation
+    std::vector<double> values(100001, 1e-16);
+    values[0] = 1.0;
+    auto const exact = 1.0 + 1e-11;
+    CHECK(std::abs(compensated_sum(values, 4) - exact) < 1e-15);
+
+    std::vector<double> cancelling{1e20, 1.0, -1e20, 1.0};
+    CHECK(compensated_sum(cancelling) == 2.0);
+
+    std::vector<double> lhs{1e10, 1.0, -1e10};
+    std::vector<double> rhs{1e10, 1.0, 1e10};
+    CHECK(compensated_dot(lhs, rhs) == 1.0);
+
+    std::vector<double> vector{3.0, 4.0};
+    CHECK(compensated_norm(vector) == 5.0);
+    CHECK(deterministic_norm(vector) == 5.0);
+
+    CompensatedSum<double> sum;
+    sum += 1.0;
+    sum += 1e-16;
+    sum += -1.0;
+    CHECK(sum.value() == 1e-16);
+
+    CompensatedSum<double> products;
+    auto const epsilon = std::ldexp(1.0, -30);
+    products.add_product(1.0 + epsilon, 1.0 - epsilon);
+    products += -1.0;
+    // the product 1 - 2^-60 rounds to 1, its rounding error is kept
+    CHECK(products.value() == -epsilon * epsilon);
+}
+} // namespace
+
+int main(int, char **)
+{
+    test_thread_count_independence();
+    test_compensation();
+    return test::result();
+}
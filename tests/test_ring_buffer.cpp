@@ -0,0 +1,150 @@
+#include <cpputility/containers/ring_buffer.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#include "check.hpp"
+
+using namespace cpputility;
+
+namespace
+{
+template<typename RingBuffer>
+void test_wrap_around()
+{
+    RingBuffer buffer(5);
+    CHECK(buffer.capacity() == 8);
+    CHECK(buffer.empty());
+
+    // move head and tail close to the end of the slots, so the next regions wrap around
+    std::vector<int> values(6);
+    std::iota(values.begin(), values.end(), 0);
+    CHECK(buffer.push(values) == 6);
+    std::vector<int> popped(6);
+    CHECK(buffer.pop(popped) == 6);
+    CHECK(popped == values);
+
+    // a claim never crosses the end of the slots, push continues at the front
+    auto region = buffer.claim(8);
+    CHECK(region.size() == 2);
+    CHECK(region.position() == 6);
+    buffer.commit(region);
+    auto peeked = buffer.peek();
+    CHECK(peeked.size() == 2);
+    buffer.release(peeked);
+
+    std::iota(values.begin(), values.end(), 100);
+    CHECK(buffer.push(values) == 6);
+    CHECK(buffer.size() == 6);
+
+    // full
+    std::vector<int> more{1, 2, 3};
+    CHECK(buffer.push(more) == 2);
+    CHECK(!buffer.try_push(4));
+
+    popped.assign(8, 0);
+    CHECK(buffer.pop(popped) == 8);
+    CHECK((popped == std::vector<int>{100, 101, 102, 103, 104, 105, 1, 2}));
+    int value = 0;
+    CHECK(!buffer.try_pop(value));
+
+    CHECK(buffer.try_push(7));
+    CHECK(buffer.try_pop(value) && value == 7);
+    CHECK(buffer.empty());
+}
+
+void test_spsc_threads()
+{
+    constexpr std::uint64_t count = 100000;
+    SpscRingBuffer<std::uint64_t> buffer(64);
+
+    std::thread producer([&buffer]() {
+        std::vector<std::uint64_t> batch(7);
+        for (std::uint64_t next = 0; next < count;) {
+            auto const size = std::min<std::uint64_t>(batch.size(), count - next);
+            for (std::uint64_t index = 0; index < size; ++index) {
+                batch[index] = next + index;
+            }
+            batch.resize(size);
+            auto const pushed = buffer.push(batch);
+            if (pushed == 0) {
+                std::this_thread::yield();
+            }
+            next += pushed;
+            batch.resize(7);
+        }
+    });
+
+    std::uint64_t expected = 0;
+    bool ordered = true;
+    while (expected < count) {
+        auto region = buffer.peek();
+        if (region.empty()) {
+            std::this_thread::yield();
+        }
+        for (auto const value : region) {
+            ordered = ordered && value == expected++;
+        }
+        buffer.release(region);
+    }
+    producer.join();
+    CHECK(ordered);
+    CHECK(buffer.empty());
+}
+
+void test_mpsc_several_producers()
+{
+    constexpr std::uint64_t producers = 4;
+    constexpr std::uint64_t countPerProducer = 20000;
+    MpscRingBuffer<std::uint64_t> buffer(128);
+
+    std::vector<std::thread> threads;
+    for (std::uint64_t producer = 0; producer < producers; ++producer) {
+        threads.emplace_back([&buffer, producer]() {
+            for (std::uint64_t sequence = 0; sequence < countPerProducer;) {
+                if (buffer.try_push(producer * countPerProducer + sequence)) {
+                    ++sequence;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    // every producer's values arrive complete and in the order they were pushed
+    std::vector<std::uint64_t> nextSequence(producers, 0);
+    bool ordered = true;
+    for (std::uint64_t received = 0; received < producers * countPerProducer;) {
+        std::uint64_t value;
+        if (buffer.try_pop(value)) {
+            auto const producer = value / countPerProducer;
+            ordered = ordered && producer < producers
+                      && value % countPerProducer == nextSequence[producer]++;
+            ++received;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    CHECK(ordered);
+    for (auto const sequence : nextSequence) {
+        CHECK(sequence == countPerProducer);
+    }
+    CHECK(buffer.empty());
+}
+} // namespace
+
+int main(int, char **)
+{
+    test_wrap_around<SpscRingBuffer<int>>();
+    test_wrap_around<MpscRingBuffer<int>>();
+    test_spsc_threads();
+    test_mpsc_several_producers();
+    return test::result();
+}
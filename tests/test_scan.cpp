@@ -0,0 +1,171 @@
+#include <cpputility/containers/storage_vector.hpp>
+#include <cpputility/scan.hpp>
+
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include "check.hpp"
+
+using namespace cpputility;
+
+namespace
+{
+constexpr size_t threads = 4;
+
+std::vector<long> random_values(size_t size)
+{
+    std::mt19937 rng(7);
+    std::vector<long> values(size);
+    for (auto &value : values) {
+        value = static_cast<long>(rng() % 100) - 50;
+    }
+    return values;
+}
+
+void test_inclusive_scan()
+{
+    for (size_t size : {0ul, 1ul, 5ul, 4097ul, 50000ul}) {
+        auto const values = random_values(size);
+        std::vector<long> expected(size);
+        std::inclusive_scan(values.begin(), values.end(), expected.begin());
+
+        std::vector<long> output(size);
+        blocked_inclusive_scan(values, output, std::plus<>{}, threads);
+        CHECK(output == expected);
+
+        // in place
+        auto inPlace = values;
+        blocked_inclusive_scan(inPlace, inPlace, std::plus<>{}, threads);
+        CHECK(inPlace == expected);
+    }
+
+    std::vector<long> values{3, 1, 4, 1, 5, 9, 2, 6};
+    std::vector<long> maxima(values.size());
+    blocked_inclusive_scan(values, maxima, [](long a, long b) { return std::max(a, b); }, threads);
+    CHECK((maxima == std::vector<long>{3, 3, 4, 4, 5, 9, 9, 9}));
+}
+
+void test_exclusive_scan()
+{
+    for (size_t size : {0ul, 1ul, 5ul, 4097ul, 50000ul}) {
+        auto const values = random_values(size);
+        std::vector<long> expected(size);
+        std::exclusive_scan(values.begin(), values.end(), expected.begin(), 10l);
+
+        std::vector<long> output(size);
+        blocked_exclusive_scan(values, output, 10l, std::plus<>{}, threads);
+        CHECK(output == expected);
+
+        auto inPlace = values;
+        blocked_exclusive_scan(inPlace, inPlace, 10l, std::plus<>{}, threads);
+        CHECK(inPlace == expected);
+    }
+}
+
+void test_scan_storage_vector()
+{
+    StorageVector<long> storage;
+    for (long value = 1; value <= 5; ++value) {
+        storage.emplace_back(std::make_unique<long>(value));
+    }
+    blocked_inclusive_scan(storage, storage, std::plus<>{}, threads);
+    CHECK(storage[0] == 1 && storage[2] == 6 && storage[4] == 15);
+}
+
+/// Sequential reference of the segmented scans.
+std::vector<long> segmented_reference(std::vector<long> const &values,
+                                      std::vector<char> const &flags,
+                                      bool inclusive,
+                                      long init)
+{
+    std::vector<long> result(values.size());
+    long sum = init;
+    for (size_t index = 0; index < values.size(); ++index) {
+        if (index == 0 || flags[index]) {
+            sum = init;
+        }
+        if (inclusive) {
+            sum += values[index];
+            result[index] = sum;
+        } else {
+            result[index] = sum;
+            sum += values[index];
+        }
+    }
+    return result;
+}
+
+void test_segmented_scans()
+{
+    for (size_t size : {1ul, 7ul, 4097ul, 50000ul}) {
+        auto const values = random_values(size);
+        std::mt19937 rng(3);
+        std::vector<char> flags(size);
+        std::vector<size_t> offsets;
+        for (size_t index = 0; index < size; ++index) {
+            flags[index] = index == 0 || rng() % 100 == 0;
+            if (flags[index]) {
+                offsets.push_back(index);
+            }
+        }
+
+        std::vector<long> output(size);
+        segmented_inclusive_scan(values, flags, output, std::plus<>{}, threads);
+        CHECK(output == segmented_reference(values, flags, true, 0));
+
+        segmented_exclusive_scan(values, flags, output, 5l, std::plus<>{}, threads);
+        CHECK(output == segmented_reference(values, flags, false, 5));
+
+        segmented_inclusive_scan_offsets(values, offsets, output, std::plus<>{}, threads);
+        CHECK(output == segmented_reference(values, flags, true, 0));
+
+        segmented_exclusive_scan_offsets(values, offsets, output, 5l, std::plus<>{}, threads);
+        CHECK(output == segmented_reference(values, flags, false, 5));
+    }
+
+    std::vector<long> values{1, 2, 3, 4, 5, 6};
+    std::vector<char> flags{1, 0, 1, 0, 0, 1};
+    std::vector<long> output(values.size());
+    segmented_inclusive_scan(values, flags, output);
+    CHECK((output == std::vector<long>{1, 3, 3, 7, 12, 6}));
+    segmented_exclusive_scan(values, flags, output, 0l);
+    CHECK((output == std::vector<long>{0, 1, 0, 3, 7, 0}));
+}
+
+void test_reduce_by_key()
+{
+    std::vector<int> keys{1, 1, 2, 3, 3, 3, 1};
+    std::vector<long> values{1, 2, 3, 4, 5, 6, 7};
+    std::vector<int> keysOut(keys.size());
+    std::vector<long> valuesOut(keys.size());
+    auto const runs = reduce_by_key(keys, values, keysOut, valuesOut, std::plus<>{}, threads);
+    CHECK(runs == 4);
+    keysOut.resize(runs);
+    valuesOut.resize(runs);
+    CHECK((keysOut == std::vector<int>{1, 2, 3, 1}));
+    CHECK((valuesOut == std::vector<long>{3, 3, 15, 7}));
+
+    std::vector<int> manyKeys(30000);
+    for (size_t index = 0; index < manyKeys.size(); ++index) {
+        manyKeys[index] = static_cast<int>(index / 10);
+    }
+    std::vector<long> ones(manyKeys.size(), 1);
+    keysOut.assign(manyKeys.size(), 0);
+    valuesOut.assign(manyKeys.size(), 0);
+    CHECK(reduce_by_key(manyKeys, ones, keysOut, valuesOut, std::plus<>{}, threads) == 3000);
+    CHECK(keysOut[2999] == 2999 && valuesOut[0] == 10 && valuesOut[2999] == 10);
+}
+} // namespace
+
+int main(int, char **)
+{
+    test_inclusive_scan();
+    test_exclusive_scan();
+    test_scan_storage_vector();
+    test_segmented_scans();
+    test_reduce_by_key();
+    return test::result();
+}
@@ -0,0 +1,91 @@
+#include <cpputility/bits.hpp>
+#include <cpputility/selection.hpp>
+
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "check.hpp"
+
+using namespace cpputility;
+
+namespace
+{
+void test_bits()
+{
+    CHECK(word_count(0) == 0);
+    CHECK(word_count(1) == 1);
+    CHECK(word_count(64) == 1);
+    CHECK(word_count(65) == 2);
+
+    CHECK(count_trailing_zeros(1) == 0);
+    CHECK(count_trailing_zeros(std::uint64_t{1} << 63) == 63);
+    CHECK(count_trailing_zeros(0b101000) == 3);
+    CHECK(count_leading_zeros(1) == 63);
+    CHECK(count_leading_zeros(std::uint64_t{1} << 63) == 0);
+    CHECK(popcount(0) == 0);
+    CHECK(popcount(~std::uint64_t{0}) == 64);
+    CHECK(popcount(0b1011) == 3);
+
+    std::vector<size_t> indices;
+    for_each_set_bit(0b100101, 64, [&indices](size_t index) { indices.push_back(index); });
+    CHECK((indices == std::vector<size_t>{64, 66, 69}));
+}
+
+void test_selection()
+{
+    std::vector<int> values(200);
+    std::iota(values.begin(), values.end(), 0);
+    auto const isMultipleOf3 = [](int value) { return value % 3 == 0; };
+
+    auto selection = select_if(values, isMultipleOf3);
+    CHECK(selection.size() == 200);
+    CHECK(selection.count() == 67);
+    CHECK(selection.mask().size() == 4);
+    for (size_t index = 0; index < values.size(); ++index) {
+        CHECK(selection.contains(index) == isMultipleOf3(values[index]));
+    }
+    for (size_t position = 0; position < selection.count(); ++position) {
+        CHECK(selection.indices()[position] == 3 * position);
+    }
+
+    // re-assigning reuses the selection for another predicate and size
+    values.resize(70);
+    selection.assign(values, [](int value) { return value >= 64; });
+    CHECK(selection.size() == 70);
+    CHECK(selection.count() == 6);
+    CHECK(selection.indices().front() == 64);
+    CHECK(selection.mask().size() == 2);
+
+    selection.assign(values, [](int) { return false; });
+    CHECK(selection.empty());
+
+    selection.clear();
+    CHECK(selection.size() == 0 && selection.empty());
+}
+
+void test_for_each_selected()
+{
+    std::vector<int> values(130);
+    std::iota(values.begin(), values.end(), 0);
+
+    auto const selection = select_if(values, [](int value) { return value % 2 == 1; });
+    for_each_selected(values, selection, [](int &value) { value = -value; });
+    for (int index = 0; index < 130; ++index) {
+        CHECK(values[static_cast<size_t>(index)] == (index % 2 == 1 ? -index : index));
+    }
+
+    int sum = 0;
+    for_each_if_compacted(
+        values, [](int value) { return value < 0; }, [&sum](int value) { sum += value; });
+    CHECK(sum == -(65 * 65));
+}
+} // namespace
+
+int main(int, char **)
+{
+    test_bits();
+    test_selection();
+    test_for_each_selected();
+    return test::result();
+}
@@ -0,0 +1,214 @@
+#include <cpputility/containers/reference_vector.hpp>
+#include <cpputility/containers/storage_vector.hpp>
+#include <cpputility/sorting.hpp>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "check.hpp"
+
+using namespace cpputility;
+
+namespace
+{
+constexpr size_t threads = 4;
+
+std::vector<int> random_values(size_t size)
+{
+    std::mt19937 rng(42);
+    std::vector<int> values(size);
+    for (auto &value : values) {
+        value = static_cast<int>(rng() % 1000) - 500;
+    }
+    return values;
+}
+
+StorageVector<int> make_storage(std::vector<int> const &values)
+{
+    StorageVector<int> storage;
+    for (auto const value : values) {
+        storage.emplace_back(std::make_unique<int>(value));
+    }
+    return storage;
+}
+
+template<typename Container>
+std::vector<int> to_vector(Container const &container)
+{
+    std::vector<int> values;
+    for (auto const &value : container) {
+        values.push_back(value);
+    }
+    return values;
+}
+
+void test_sort_vector()
+{
+    for (size_t size : {0ul, 1ul, 100ul, 20000ul}) {
+        auto values = random_values(size);
+        auto expected = values;
+        std::sort(expected.begin(), expected.end());
+
+        auto sorted = values;
+        parallel_sort(sorted, std::less<>{}, threads);
+        CHECK(sorted == expected);
+
+        sorted = values;
+        parallel_stable_sort(sorted, std::less<>{}, threads);
+        CHECK(sorted == expected);
+
+        sorted = values;
+        radix_sort(sorted, threads);
+        CHECK(sorted == expected);
+    }
+}
+
+void test_stable_sort_keeps_order()
+{
+    std::vector<std::pair<int, int>> values;
+    for (int index = 0; index < 20000; ++index) {
+        values.emplace_back(index % 7, index);
+    }
+    auto const byKey = [](auto const &lhs, auto const &rhs) { return lhs.first < rhs.first; };
+    auto expected = values;
+    std::stable_sort(expected.begin(), expected.end(), byKey);
+
+    parallel_stable_sort(values, byKey, threads);
+    CHECK(values == expected);
+}
+
+void test_radix_sort_by_key()
+{
+    std::vector<double> values{3.5, -1.0, 0.0, -7.25, 2.0, -0.5, 1e10, -1e10};
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+    radix_sort(values, threads);
+    CHECK(values == expected);
+
+    std::vector<std::pair<int, int>> pairs{{3, 0}, {-1, 1}, {3, 2}, {-1, 3}, {0, 4}};
+    radix_sort_by_key(pairs, [](auto const &pair) { return pair.first; }, threads);
+    CHECK((pairs == std::vector<std::pair<int, int>>{{-1, 1}, {-1, 3}, {0, 4}, {3, 0}, {3, 2}}));
+}
+
+void test_nth_element()
+{
+    auto values = random_values(1001);
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+    nth_element(values, 500);
+    CHECK(values[500] == expected[500]);
+    CHECK(std::all_of(values.begin(), values.begin() + 500, [&values](int value) {
+        return value <= values[500];
+    }));
+}
+
+void test_partition_vector()
+{
+    auto const isNegative = [](int value) { return value < 0; };
+    auto const values = random_values(20000);
+    auto const negatives = std::count_if(values.begin(), values.end(), isNegative);
+
+    auto partitioned = values;
+    auto point = partition(partitioned, isNegative);
+    CHECK(point == negatives);
+    CHECK(std::is_partitioned(partitioned.begin(), partitioned.end(), isNegative));
+
+    auto expected = values;
+    std::stable_partition(expected.begin(), expected.end(), isNegative);
+
+    partitioned = values;
+    point = stable_partition(partitioned, isNegative);
+    CHECK(point == negatives);
+    CHECK(partitioned == expected);
+
+    partitioned = values;
+    point = parallel_partition(partitioned, isNegative, threads);
+    CHECK(point == negatives);
+    CHECK(partitioned == expected);
+}
+
+void test_storage_vector_moves_pointers()
+{
+    auto const values = random_values(10000);
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    auto storage = make_storage(values);
+    std::vector<int const *> objects;
+    for (auto const &value : storage) {
+        objects.push_back(&value);
+    }
+
+    parallel_sort(storage, std::less<>{}, threads);
+    CHECK(to_vector(storage) == expected);
+    // the objects stay where they are, only the pointers are reordered
+    for (auto const &value : storage) {
+        CHECK(std::find(objects.begin(), objects.end(), &value) != objects.end());
+    }
+
+    auto radixSorted = make_storage(values);
+    radix_sort(radixSorted, threads);
+    CHECK(to_vector(radixSorted) == expected);
+
+    auto const isNegative = [](int value) { return value < 0; };
+    auto partitioned = make_storage(values);
+    auto const point = parallel_partition(partitioned, isNegative, threads);
+    CHECK(point == std::count_if(values.begin(), values.end(), isNegative));
+    CHECK(std::is_partitioned(partitioned.begin(), partitioned.end(), isNegative));
+}
+
+void test_reference_vector_keeps_objects()
+{
+    auto values = random_values(10000);
+    auto const original = values;
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    ReferenceVector<int> references;
+    for (auto &value : values) {
+        references.emplace_back(value);
+    }
+
+    parallel_sort(references, std::less<>{}, threads);
+    CHECK(to_vector(references) == expected);
+    CHECK(values == original);
+
+    radix_sort(references, threads);
+    CHECK(to_vector(references) == expected);
+    CHECK(values == original);
+
+    auto const isNegative = [](int value) { return value < 0; };
+    auto const point = parallel_partition(references, isNegative, threads);
+    CHECK(point == std::count_if(values.begin(), values.end(), isNegative));
+    CHECK(std::is_partitioned(references.begin(), references.end(), isNegative));
+    partition(references, isNegative);
+    nth_element(references, 10);
+    CHECK(values == original);
+
+    int a = 3;
+    int b = 1;
+    int c = 2;
+    ReferenceVector<int> small;
+    small.emplace_back(a);
+    small.emplace_back(b);
+    small.emplace_back(c);
+    parallel_sort(small);
+    CHECK(&small[0] == &b && &small[1] == &c && &small[2] == &a);
+    CHECK(a == 3 && b == 1 && c == 2);
+}
+} // namespace
+
+int main(int, char **)
+{
+    test_sort_vector();
+    test_stable_sort_keeps_order();
+    test_radix_sort_by_key();
+    test_nth_element();
+    test_partition_vector();
+    test_storage_vector_moves_pointers();
+    test_reference_vector_keeps_objects();
+    return test::result();
+}
@@ -0,0 +1,103 @@
+#include <cpputility/containers/sparse_vector.hpp>
+#include <cpputility/containers/storage_vector.hpp>
+#include <cpputility/containers/vector_view.hpp>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "check.hpp"
+
+using namespace cpputility;
+
+namespace
+{
+SparseVector<double> make_sparse(ptrdiff_t size, std::vector<std::pair<ptrdiff_t, double>> entries)
+{
+    SparseVector<double> sparse(size);
+    for (auto const &[pos, value] : entries) {
+        sparse.set(pos, value);
+    }
+    return sparse;
+}
+
+void test_pattern()
+{
+    SparseVector<double> sparse(10);
+    sparse.push_back(2, 1.0);
+    sparse.push_back(7, 2.0);
+    sparse.set(4, 3.0);
+    sparse.set(7, 4.0);
+    CHECK(sparse.size() == 10);
+    CHECK(sparse.nonzeros() == 3);
+    CHECK((std::vector<ptrdiff_t>(sparse.indices().begin(), sparse.indices().end())
+           == std::vector<ptrdiff_t>{2, 4, 7}));
+    CHECK(sparse[4] == 3.0 && sparse[7] == 4.0 && sparse[0] == 0.0 && sparse[9] == 0.0);
+
+    double sum = 0;
+    for (auto const value : sparse) {
+        sum += value;
+    }
+    CHECK(sum == 8.0);
+
+    sparse.values()[0] = 1e-12;
+    sparse.prune(1e-9);
+    CHECK(sparse.nonzeros() == 2);
+    CHECK(sparse[2] == 0.0);
+
+    sparse.resize(5);
+    CHECK(sparse.size() == 5 && sparse.nonzeros() == 1);
+}
+
+void test_dense_kernels()
+{
+    std::vector<double> dense{1.0, 0.0, 2.0, 0.0, 0.0, 3.0};
+    auto const sparse = sparse_from_dense(dense);
+    CHECK(sparse.nonzeros() == 3);
+    CHECK(dot(sparse, dense) == 1.0 + 4.0 + 9.0);
+
+    std::vector<double> target(6, 1.0);
+    axpy(2.0, sparse, target);
+    CHECK((target == std::vector<double>{3.0, 1.0, 5.0, 1.0, 1.0, 7.0}));
+
+    to_dense(sparse, target);
+    CHECK(target == dense);
+
+    // through a view and a StorageVector without contiguous data()
+    std::vector<double> other(6, 5.0);
+    VectorView<std::vector<double>> view(other);
+    scatter(sparse, view);
+    CHECK((other == std::vector<double>{1.0, 5.0, 2.0, 5.0, 5.0, 3.0}));
+
+    StorageVector<double> storage;
+    for (int index = 0; index < 6; ++index) {
+        storage.emplace_back(std::make_unique<double>(1.0));
+    }
+    CHECK(dot(sparse, storage) == 6.0);
+}
+
+void test_sparse_kernels()
+{
+    auto const lhs = make_sparse(8, {{1, 1.0}, {3, 2.0}, {6, 3.0}});
+    auto const rhs = make_sparse(8, {{0, 4.0}, {3, 5.0}, {6, 6.0}, {7, 7.0}});
+    CHECK(dot(lhs, rhs) == 10.0 + 18.0);
+    CHECK(dot(lhs, SparseVector<double>(8)) == 0.0);
+
+    auto const sum = merge(lhs, rhs);
+    CHECK(sum.nonzeros() == 5);
+    CHECK(sum[0] == 4.0 && sum[1] == 1.0 && sum[3] == 7.0 && sum[6] == 9.0 && sum[7] == 7.0);
+
+    auto target = rhs;
+    axpy(2.0, lhs, target);
+    CHECK(target.nonzeros() == 5);
+    CHECK(target[1] == 2.0 && target[3] == 9.0 && target[6] == 12.0 && target[0] == 4.0);
+}
+} // namespace
+
+int main(int, char **)
+{
+    test_pattern();
+    test_dense_kernels();
+    test_sparse_kernels();
+    return test::result();
+}
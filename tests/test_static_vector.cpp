@@ -0,0 +1,84 @@
+#include <cpputility/containers/static_vector.hpp>
+#include <cpputility/containers/vector_slice.hpp>
+
+#include <string>
+
+#include "check.hpp"
+
+using namespace cpputility;
+
+namespace
+{
+constexpr int sum_of_squares(int count)
+{
+    StaticVector<int, 16> values;
+    for (int value = 1; value <= count; ++value) {
+        values.push_back(value * value);
+    }
+    int sum = 0;
+    for (auto const value : values) {
+        sum += value;
+    }
+    return sum;
+}
+
+constexpr int strided_sum()
+{
+    StaticVector<int, 8> values{1, 2, 3, 4, 5, 6, 7, 8};
+    for (auto &value : slice(values, 0, 8, 2)) {
+        value *= 10;
+    }
+    int sum = 0;
+    for (auto const value : values) {
+        sum += value;
+    }
+    return sum;
+}
+
+constexpr StaticVector<int, 4> make_resized()
+{
+    StaticVector<int, 4> values(2, 7);
+    values.emplace_back(3);
+    values.pop_back();
+    values.resize(4, 1);
+    return values;
+}
+
+// evaluated at compile time
+static_assert(sum_of_squares(3) == 14);
+static_assert(strided_sum() == 10 + 2 + 30 + 4 + 50 + 6 + 70 + 8);
+static_assert(make_resized().size() == 4);
+static_assert(make_resized()[1] == 7 && make_resized()[2] == 1);
+static_assert(StaticVector<int, 3>{4, 5, 6}.back() == 6);
+static_assert(StaticVector<double, 5>::capacity() == 5);
+
+void test_runtime()
+{
+    StaticVector<std::string, 3> names;
+    CHECK(names.empty());
+    names.push_back("a");
+    names.emplace_back(2, 'b');
+    names.push_back(std::string("c"));
+    CHECK(names.full());
+    CHECK(names.front() == "a" && names[1] == "bb" && names.back() == "c");
+
+    names.pop_back();
+    CHECK(names.size() == 2);
+    names.resize(1);
+    CHECK(names.size() == 1 && names.back() == "a");
+    names.clear();
+    CHECK(names.empty());
+
+    StaticVector<int, 6> values{1, 2, 3, 4, 5, 6};
+    auto const evens = const_slice(values, 1, 6, 2);
+    CHECK(evens.size() == 2);
+    CHECK(evens[0] == 2 && evens[1] == 4);
+    CHECK(values.data()[5] == 6);
+}
+} // namespace
+
+int main(int, char **)
+{
+    test_runtime();
+    return test::result();
+}
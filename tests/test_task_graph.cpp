@@ -0,0 +1,192 @@
+#include <cpputility/task_graph.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+#include "check.hpp"
+
+using namespace cpputility;
+
+namespace
+{
+/// Layered graph where every task of a layer depends on two tasks of the previous layer; every
+/// task records when it started and finished.
+struct LayeredGraph
+{
+    static constexpr size_t layers = 6;
+    static constexpr size_t width = 5;
+
+    TaskGraph graph;
+    std::atomic<size_t> clock{0};
+    std::vector<size_t> started = std::vector<size_t>(layers * width);
+    std::vector<size_t> finished = std::vector<size_t>(layers * width);
+
+    LayeredGraph()
+    {
+        for (size_t task = 0; task < layers * width; ++task) {
+            graph.add_task([this, task]() {
+                started[task] = clock++;
+                finished[task] = clock++;
+            });
+        }
+        for (size_t task = width; task < layers * width; ++task) {
+            auto const layer = task / width;
+            graph.add_dependency(task, (layer - 1) * width + task % width);
+            graph.add_dependency(task, (layer - 1) * width + (task + 1) % width);
+        }
+    }
+
+    bool ordered() const
+    {
+        bool result = true;
+        for (size_t task = width; task < layers * width; ++task) {
+            auto const layer = task / width;
+            result = result && started[task] > finished[(layer - 1) * width + task % width]
+                     && started[task] > finished[(layer - 1) * width + (task + 1) % width];
+        }
+        return result;
+    }
+};
+
+void test_dependencies(TaskScheduler &scheduler)
+{
+    LayeredGraph layered;
+    for (int repetition = 0; repetition < 3; ++repetition) {
+        layered.clock = 0;
+        scheduler.run(layered.graph);
+        CHECK(layered.clock == 2 * LayeredGraph::layers * LayeredGraph::width);
+        CHECK(layered.ordered());
+    }
+
+    TaskGraph graph;
+    std::vector<int> order;
+    auto const first = graph.add_task([&order]() { order.push_back(1); });
+    auto const second = graph.add_task([&order]() { order.push_back(2); }, {first});
+    graph.add_task([&order]() { order.push_back(3); }, {first, second});
+    scheduler.run(graph);
+    CHECK((order == std::vector<int>{1, 2, 3}));
+
+    TaskGraph empty;
+    scheduler.run(empty);
+}
+
+void test_chunks(TaskScheduler &scheduler)
+{
+    std::vector<std::atomic<int>> counts(1000);
+    std::vector<double> values(1001, 1.0);
+    std::atomic<int> slices{0};
+    std::atomic<bool> scaledFirst{true};
+
+    TaskGraph graph;
+    auto const chunked = graph.add_chunked_task(
+        counts.size(), [&counts](size_t chunk) { ++counts[chunk]; });
+    auto const scale = graph.add_partitioned_task(values, 100, [&](auto slice) {
+        ++slices;
+        for (ptrdiff_t pos = 0; pos < slice.size(); ++pos) {
+            slice[pos] *= 2.0;
+        }
+    });
+    graph.add_partitioned_task(values, 100, [&](auto slice) {
+        for (ptrdiff_t pos = 0; pos < slice.size(); ++pos) {
+            scaledFirst = scaledFirst && slice[pos] == 2.0;
+            slice[pos] += 1.0;
+        }
+    });
+    graph.add_dependency(2, scale);
+    graph.add_dependency(scale, chunked);
+    scheduler.run(graph);
+
+    bool once = true;
+    for (auto const &count : counts) {
+        once = once && count == 1;
+    }
+    CHECK(once);
+    CHECK(slices == 11);
+    CHECK(scaledFirst);
+    CHECK(values.front() == 3.0 && values.back() == 3.0);
+}
+
+void test_exceptions(TaskScheduler &scheduler)
+{
+    TaskGraph graph;
+    std::atomic<bool> dependentRan{false};
+    auto const failing = graph.add_chunked_task(8, [](size_t chunk) {
+        if (chunk == 5) {
+            throw std::runtime_error("chunk 5");
+        }
+    });
+    graph.add_task([&dependentRan]() { dependentRan = true; }, {failing});
+
+    bool rethrown = false;
+    try {
+        scheduler.run(graph);
+    } catch (std::runtime_error const &) {
+        rethrown = true;
+    }
+    CHECK(rethrown);
+    CHECK(!dependentRan);
+
+    // the scheduler stays usable
+    LayeredGraph layered;
+    scheduler.run(layered.graph);
+    CHECK(layered.ordered());
+}
+
+void test_invalid_graphs(TaskScheduler &scheduler)
+{
+    TaskGraph graph;
+    std::atomic<int> runs{0};
+    auto const first = graph.add_task([&runs]() { ++runs; });
+    auto const second = graph.add_task([&runs]() { ++runs; }, {first});
+    auto const third = graph.add_task([&runs]() { ++runs; }, {second});
+
+    bool outOfRange = false;
+    try {
+        graph.add_dependency(third, 3);
+    } catch (std::out_of_range const &) {
+        outOfRange = true;
+    }
+    CHECK(outOfRange);
+
+    bool selfDependency = false;
+    try {
+        graph.add_dependency(second, second);
+    } catch (std::invalid_argument const &) {
+        selfDependency = true;
+    }
+    CHECK(selfDependency);
+
+    // the rejected dependencies were not added
+    scheduler.run(graph);
+    CHECK(runs == 3);
+
+    graph.add_dependency(first, third);
+    bool cycle = false;
+    try {
+        scheduler.run(graph);
+    } catch (std::invalid_argument const &) {
+        cycle = true;
+    }
+    CHECK(cycle);
+    CHECK(runs == 3);
+
+    graph.clear();
+    graph.add_task([&runs]() { ++runs; });
+    scheduler.run(graph);
+    CHECK(runs == 4);
+}
+} // namespace
+
+int main(int, char **)
+{
+    for (size_t threads : {1ul, 4ul}) {
+        TaskScheduler scheduler(threads);
+        CHECK(scheduler.thread_count() == threads);
+        test_dependencies(scheduler);
+        test_chunks(scheduler);
+        test_exceptions(scheduler);
+        test_invalid_graphs(scheduler);
+    }
+    return test::result();
+}
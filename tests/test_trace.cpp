@@ -0,0 +1,140 @@
+#include <cpputility/parallel.hpp>
+#include <cpputility/trace.hpp>
+
+#include <limits>
+#include <sstream>
+#include <string>
+
+#include "check.hpp"
+
+using namespace cpputility;
+
+namespace
+{
+size_t count(std::string const &text, std::string const &pattern)
+{
+    size_t result = 0;
+    for (auto pos = text.find(pattern); pos != std::string::npos;
+         pos = text.find(pattern, pos + 1)) {
+        ++result;
+    }
+    return result;
+}
+
+std::string chrome_trace()
+{
+    std::ostringstream stream;
+    write_chrome_trace(stream);
+    return stream.str();
+}
+
+void test_buffer()
+{
+    TraceBuffer buffer(0, 4);
+    for (int step = 0; step < 6; ++step) {
+        TraceEvent event;
+        event.timestamp = step;
+        buffer.record(event);
+    }
+    CHECK(buffer.dropped() == 2);
+    std::string timestamps;
+    buffer.for_each([&timestamps](TraceEvent const &event) {
+        timestamps += std::to_string(event.timestamp);
+    });
+    CHECK(timestamps == "2345");
+    buffer.clear();
+    CHECK(buffer.dropped() == 0);
+
+    TraceBuffer single(1, 0);
+    TraceEvent event;
+    event.timestamp = 7;
+    single.record(event);
+    single.record(event);
+    CHECK(single.dropped() == 1);
+}
+
+void test_chrome_trace()
+{
+    auto &registry = TraceRegistry::instance();
+    registry.clear();
+    {
+        ScopedTraceRegion region("solve");
+        trace_counter("residual", 0.5);
+    }
+    parallel_invoke_n(3, [](size_t) { ScopedTraceRegion region("worker"); });
+
+    auto const trace = chrome_trace();
+    CHECK(trace.rfind("{\"traceEvents\":[", 0) == 0);
+    CHECK(trace.find("\n],\"displayTimeUnit\":\"ms\"}\n") != std::string::npos);
+    CHECK(count(trace, "{\"name\":\"solve\",\"ph\":\"X\"") == 1);
+    CHECK(count(trace, "{\"name\":\"worker\",\"ph\":\"X\"") == 3);
+    CHECK(count(trace, "\"args\":{\"value\":0.5}}") == 1);
+
+    registry.set_enabled(false);
+    trace_counter("disabled", 1.0);
+    registry.set_enabled(true);
+    CHECK(chrome_trace().find("disabled") == std::string::npos);
+
+    registry.clear();
+    CHECK(chrome_trace().find("solve") == std::string::npos);
+
+    // counters keep all digits
+    trace_counter("small", 1e-5);
+    auto const small = chrome_trace();
+    auto const value = small.find("\"value\":", small.find("\"small\""));
+    CHECK(value != std::string::npos && std::stod(small.substr(value + 8)) == 1e-5);
+    registry.clear();
+}
+
+void test_capacity()
+{
+    auto &registry = TraceRegistry::instance();
+    registry.clear();
+    // buffers created now keep the last event only
+    registry.set_buffer_capacity(0);
+    parallel_invoke_n(8, [](size_t) {
+        trace_counter("capped", 1.0);
+        trace_counter("capped", 2.0);
+    });
+    registry.set_buffer_capacity(default_trace_buffer_capacity);
+    auto const events = count(chrome_trace(), "\"capped\"");
+    CHECK(events >= 8 && events <= 16);
+    registry.clear();
+}
+
+void test_json_escaping()
+{
+    auto &registry = TraceRegistry::instance();
+    registry.clear();
+    trace_counter("nan", std::numeric_limits<double>::quiet_NaN());
+    trace_counter("inf", -std::numeric_limits<double>::infinity());
+    trace_counter("quote\"back\\slash", 1.0);
+    trace_counter("line\nfeed\ttab\x1f", 2.0);
+
+    auto const trace = chrome_trace();
+    CHECK(count(trace, "\"args\":{\"value\":null}}") == 2);
+    CHECK(trace.find("nan}") == std::string::npos && trace.find("inf}") == std::string::npos);
+    CHECK(trace.find("\"quote\\\"back\\\\slash\"") != std::string::npos);
+    CHECK(trace.find("\"line\\u000afeed\\u0009tab\\u001f\"") != std::string::npos);
+    // raw control characters are only allowed between the events
+    bool controlInString = false;
+    bool inString = false;
+    for (size_t pos = 0; pos < trace.size(); ++pos) {
+        if (trace[pos] == '"' && trace[pos - 1] != '\\') {
+            inString = !inString;
+        }
+        controlInString = controlInString || (inString && trace[pos] < 0x20);
+    }
+    CHECK(!controlInString);
+    registry.clear();
+}
+} // namespace
+
+int main(int, char **)
+{
+    test_buffer();
+    test_chrome_trace();
+    test_capacity();
+    test_json_escaping();
+    return test::result();
+}
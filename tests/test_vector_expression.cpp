@@ -0,0 +1,125 @@
+#include <cpputility/containers/vector_expression.hpp>
+#include <cpputility/containers/vector_slice.hpp>
+#include <cpputility/containers/vector_view.hpp>
+
+#include <cmath>
+#include <vector>
+
+#include "check.hpp"
+
+using namespace cpputility;
+
+namespace
+{
+std::vector<double> ramp(size_t size, double offset = 0.0)
+{
+    std::vector<double> values(size);
+    for (size_t pos = 0; pos < size; ++pos) {
+        values[pos] = static_cast<double>(pos) + offset;
+    }
+    return values;
+}
+
+void test_views()
+{
+    auto xValues = ramp(100);
+    auto yValues = ramp(100, 1.0);
+    std::vector<double> zValues(100);
+    VectorView<std::vector<double>> x(xValues);
+    VectorView<std::vector<double>> y(yValues);
+    VectorView<std::vector<double>> z(zValues);
+    ConstVectorView<std::vector<double>> yConst(yValues);
+
+    z = x + y;
+    CHECK(zValues[10] == 21.0);
+    z = 2.0 * x - yConst / 2.0;
+    CHECK(zValues[10] == 20.0 - 5.5);
+    z = -(x * y) + 1;
+    CHECK(zValues[10] == -109.0);
+    z = map_expression(x - 50.0, [](double value) { return std::abs(value); });
+    CHECK(zValues[10] == 40.0 && zValues[60] == 10.0);
+
+    // the expression may read the target at the same position
+    double const dt = 0.5;
+    x = x + dt * y;
+    CHECK(xValues[10] == 15.5);
+
+    // plain assignment of views rebinds the view, assign() copies the elements
+    assign(z, x);
+    z += y;
+    CHECK(zValues[10] == 26.5);
+    z -= 0.5;
+    CHECK(zValues[10] == 26.0);
+    z *= y;
+    CHECK(zValues[10] == 286.0);
+    z /= 2.0;
+    CHECK(zValues[10] == 143.0);
+
+    // expressions are evaluated lazily and element-wise
+    auto const expression = x * y + 1.0;
+    CHECK(expression.size() == 100);
+    yValues[3] = 0.0;
+    CHECK(expression[3] == 1.0);
+}
+
+void test_slices()
+{
+    auto values = ramp(20);
+    // every second element of [0, 20) and of [1, 21)
+    auto even = slice(values, 0, 20, 2);
+    auto odd = const_slice(values, 1, 21, 2);
+    CHECK(even.size() == 10 && odd.size() == 10);
+
+    even = even * 10.0 + odd;
+    CHECK(values[4] == 45.0 && values[5] == 5.0 && values[18] == 199.0);
+
+    auto head = slice(values, 0, 5, 1);
+    head += 1.0;
+    CHECK(values[0] == 2.0 && values[1] == 2.0 && values[4] == 46.0 && values[5] == 5.0);
+
+    std::vector<double> target(10);
+    VectorView<std::vector<double>> targetView(target);
+    targetView = odd - even;
+    CHECK(target[2] == 5.0 - 46.0);
+
+    // disjoint parts of the same vector
+    auto tail = const_slice(values, 15, 20, 1);
+    assign(head, tail * 2.0 + head);
+    CHECK(values[0] == 2.0 + 2.0 * 15.0 && values[4] == 46.0 + 2.0 * 19.0);
+}
+
+void test_parallel()
+{
+    auto const size = default_parallel_expression_size * 3 + 17;
+    auto xValues = ramp(size);
+    auto yValues = ramp(size, 2.0);
+    std::vector<double> zValues(size);
+    VectorView<std::vector<double>> x(xValues);
+    VectorView<std::vector<double>> y(yValues);
+    VectorView<std::vector<double>> z(zValues);
+
+    for (size_t threads : {1ul, 2ul, 5ul}) {
+        assign(z, x * y - x, threads);
+        bool correct = true;
+        for (size_t pos = 0; pos < size; ++pos) {
+            auto const value = static_cast<double>(pos);
+            correct = correct && zValues[pos] == value * (value + 2.0) - value;
+        }
+        CHECK(correct);
+    }
+
+    assign(z, 3.0, 4);
+    CHECK(zValues.front() == 3.0 && zValues.back() == 3.0);
+
+    z = -z;
+    CHECK(zValues[size / 2] == -3.0 && zValues.back() == -3.0);
+}
+} // namespace
+
+int main(int, char **)
+{
+    test_views();
+    test_slices();
+    test_parallel();
+    return test::result();
+}